@@ -0,0 +1,63 @@
+#!/bin/bash
+# Two-stage profile-guided + link-time optimized build of planet
+#
+# 1. Builds the instrumented binary (ReleasePGOTrain -> bin/planetpgi)
+# 2. Trains it by replaying a recorded session (see [Replay] in planet.ini)
+# 3. Rebuilds with the collected profile (ReleasePGO -> bin/planetpgo)
+# 4. Times the plain Release build against the PGO one on the same replay
+#
+# Usage: build/pgo.sh [session.rpl] [runs]
+# The session path is relative to bin/, record one with `[Replay] Record = <path>`.
+
+set -e
+
+root="$(cd "$(dirname "$0")/.." && pwd)"
+session="${1:-../build/pgo/session.rpl}"
+runs="${2:-3}"
+
+case "$(uname -s)" in
+  Darwin) gmake="$root/build/mac/gmake"; platform=univ64;;
+  *) gmake="$root/build/linux/gmake"; platform=64;;
+esac
+
+if [ ! -d "$gmake" ]; then
+  echo "No makefiles in $gmake, run premake4 gmake from build/ first." >&2
+  exit 1
+fi
+
+if [ ! -f "$root/bin/$session" ]; then
+  echo "No replay session at bin/$session." >&2
+  echo "Record one by adding this to planet.ini and playing a full game:" >&2
+  echo "  [Replay]" >&2
+  echo "  Record = $session" >&2
+  exit 1
+fi
+
+pgo="$root/build/pgo"
+mkdir -p "$pgo"
+find "$pgo" \( -name '*.gcda' -o -name '*.profraw' -o -name '*.profdata' \) -delete
+
+train="$pgo/train.ini"
+printf '@planet.ini@\n\n[Replay]\nPlay = %s\n' "$session" > "$train"
+
+echo "==== Stage 1: instrumented build ===="
+make -C "$gmake" config=releasepgotrain$platform
+
+echo "==== Training on <$session> ===="
+(cd "$root/bin" && ./planetpgi -c ../build/pgo/train.ini)
+
+if ls "$pgo"/*.profraw > /dev/null 2>&1; then
+  xcrun llvm-profdata merge -o "$pgo/default.profdata" "$pgo"/*.profraw 2> /dev/null || llvm-profdata merge -o "$pgo/default.profdata" "$pgo"/*.profraw
+fi
+
+echo "==== Stage 2: optimized builds ===="
+make -C "$gmake" config=releasepgo$platform
+make -C "$gmake" config=release$platform
+
+echo "==== Benchmark: $runs runs each ===="
+for binary in planet planetpgo; do
+  for ((i = 1; i <= runs; i++)); do
+    time=$(cd "$root/bin" && ./$binary -c ../build/pgo/train.ini 2>&1 | sed -n 's/.*\[REPLAY\] Played .* in \([0-9.]*\)s\..*/\1/p')
+    echo "$binary run $i: ${time:-?}s"
+  done
+done
@@ -12,6 +12,8 @@ function initconfigurations ()
         "Debug",
         "Profile",
         "Release",
+        "ReleasePGOTrain",
+        "ReleasePGO",
         "Bundle"
     }
 end
@@ -66,6 +68,7 @@ end
 
 destination = _OPTIONS["to"] or "./" .. osname .. "/" .. _ACTION
 copybase = path.rebase ("..", os.getcwd (), os.getcwd () .. "/" .. destination)
+pgobase = "$(CURDIR)/" .. copybase .. "/build/pgo"
 
 
 --
@@ -244,6 +247,43 @@ solution "planet"
         }
 
 
+
+-- Profile-guided & link-time optimized release, see pgo.sh:
+-- ReleasePGOTrain is instrumented and gathers a profile while replaying a session,
+-- ReleasePGO is rebuilt with it. Scroll & orxBundle are implemented in headers,
+-- so LTO covers them along with the game's sources.
+
+    configuration {"*ReleasePGOTrain*"}
+        targetsuffix ("pgi")
+
+    configuration {"*ReleasePGO"}
+        targetsuffix ("pgo")
+
+    configuration {"*PGO*", "not windows"}
+        buildoptions {"-flto"}
+        linkoptions {"-flto"}
+
+    configuration {"*ReleasePGOTrain*", "not windows"}
+        buildoptions {"-fprofile-generate=" .. pgobase}
+        linkoptions {"-fprofile-generate=" .. pgobase}
+
+    configuration {"*ReleasePGO", "not windows"}
+        buildoptions {"-fprofile-use=" .. pgobase}
+        linkoptions {"-fprofile-use=" .. pgobase}
+
+    configuration {"linux", "*ReleasePGO"}
+        buildoptions {"-fprofile-correction", "-Wno-missing-profile"}
+
+    configuration {"windows", "vs*", "*PGO*"}
+        buildoptions {"/GL"}
+
+    configuration {"windows", "vs*", "*ReleasePGOTrain*"}
+        linkoptions {"/LTCG", "/GENPROFILE:PGD=$(OutDir)planet.pgd"}
+
+    configuration {"windows", "vs*", "*ReleasePGO"}
+        linkoptions {"/LTCG", "/USEPROFILE:PGD=$(OutDir)planet.pgd"}
+
+
 --
 -- Project: planet
 --
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+
+#include "planet.h"
+
+namespace game
+{
+  /// Offline texture atlas packer, run as part of the bundle step (`-b`)
+  ///
+  /// Textures of the graphics listed in `Atlas.GraphicList` are packed into a
+  /// single texture, along with a config file that points those graphics to
+  /// it with `TextureOrigin`/`TextureSize`. The config is loaded at startup
+  /// when present, so planets of all tiers and the dropper share one texture
+  /// and render in a handful of batches.
+  ///
+  /// Graphics whose section also defines the object `Scale` (eg. planets, with
+  /// `Graphic = @`) are downscaled to their on-screen footprint, times
+  /// `Atlas.Oversample`, and keep their original size through `Size`.
+  class Atlas
+  {
+  public:
+    static Atlas &Get();
+
+    /// @brief Load the atlas config if it has been generated
+    /// @param build Pack a fresh atlas first, done when bundling
+    void Init(bool build);
+
+    /// @brief Pack the atlas texture and write its config
+    /// @return `true` on success
+    bool Build() const;
+
+  private:
+    struct Sprite
+    {
+      const orxSTRING graphic{orxNULL};
+      const orxSTRING texture{orxNULL};
+      /// Original size, kept as object size when downscaled
+      orxU32 sourceWidth{0};
+      orxU32 sourceHeight{0};
+      orxU32 width{0};
+      orxU32 height{0};
+      orxU32 x{0};
+      orxU32 y{0};
+      /// RGBA, `width` x `height`
+      std::vector<orxU8> pixels{};
+    };
+
+    /// @brief Load a sprite's texture and resize it to its footprint
+    static bool Load(Sprite &sprite, orxFLOAT oversample);
+
+    /// @brief Place sprites on shelves, tallest first
+    /// @return `false` if they don't fit in `maxSize`
+    static bool Pack(std::vector<Sprite> &sprites, orxU32 maxSize, orxU32 padding, orxU32 &width, orxU32 &height);
+
+    bool WriteConfig(const std::vector<Sprite> &sprites) const;
+  };
+}
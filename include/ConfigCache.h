@@ -0,0 +1,43 @@
+#pragma once
+
+#include "planet.h"
+
+namespace game
+{
+  /// Config precompiled when bundling: the whole resolved config tree, with
+  /// command results frozen, saved as a single flat file that gets bundled
+  ///
+  /// At startup, a bundled cache is loaded instead of the main config file and
+  /// its includes, so nothing gets re-evaluated but `ConfigCache.LiveConfig`,
+  /// loaded on top of it. Loose cache files are ignored, so edited config
+  /// files never get shadowed by a stale cache.
+  ///
+  /// Live config is loaded while bootstrapping, as it would be when included
+  /// by the main config file: it can't use game commands (`Random.Pick`, ...),
+  /// which only get registered in `planet::Init`.
+  class ConfigCache
+  {
+  public:
+    static ConfigCache &Get();
+
+    /// @brief Read the command line: the cache is rebuilt rather than used when bundling
+    void SetArgs(int argc, char **argv);
+
+    /// @brief Load the bundled cache, if any
+    /// @return `true` if loaded, the default config file must then be skipped
+    bool Bootstrap();
+
+  private:
+    static orxSTATUS orxFASTCALL OnBootstrapEvent(const orxEVENT *_pstEvent);
+    static orxBOOL orxFASTCALL SaveFilter(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption);
+
+    /// @brief Save the cache, then locate it so that it gets bundled
+    void Build();
+
+    /// @brief Cache name, from the main config file's: `planet.ini` is cached as `planet.cache.ini`
+    const orxSTRING GetName();
+
+    bool bundling{false};
+    orxCHAR name[256]{};
+  };
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "orx.h"
+#include "orxBundle.h"
+
+/// Prototypes for orxExtensions.h, which is implemented in its own unit
+/// (src/orxExtensions.cpp): it defines its functions & pulls in lz4 and the
+/// bundle data, so it can't be included anywhere else. orxBundle.h only
+/// declares its functions unless orxBUNDLE_IMPL is defined.
+
+void InitExtensions();
+void ExitExtensions();
+void BootstrapExtensions();
+
+/// @brief Whether a resource location lies in a bundle, rather than loose on disk
+///
+/// Outputs generated when bundling (-b) are only used from the bundle, so
+/// leftovers of an earlier run never shadow edited sources.
+inline bool IsBundled(const orxSTRING location)
+{
+  const orxRESOURCE_TYPE_INFO *type = (location != orxNULL) ? orxResource_GetType(location) : orxNULL;
+  return type != orxNULL && orxString_Compare(type->zTag, orxBUNDLE_KZ_RESOURCE_TAG) == 0;
+}
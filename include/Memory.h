@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Extensions.h"
+#include "planet.h"
+
+namespace game
+{
+  /// Memory held by the game's main subsystems, with high-water marks and
+  /// per-subsystem budgets
+  ///
+  /// Sampled every `Memory.CheckPeriod` seconds: bundle buffers (from
+  /// orxBundle), Scroll object banks, textures and sounds. A subsystem going
+  /// over its budget (`Memory.<Subsystem>Budget`, in KB, 0 for none) logs its
+  /// largest offenders, once per crossing. Current & peak values are also
+  /// exposed as metrics and listed by `Memory.Report`.
+  class Memory
+  {
+  public:
+    enum class Subsystem
+    {
+      Bundle,
+      BundleScratch,
+      ScrollBanks,
+      Textures,
+      Sounds,
+      Count
+    };
+
+    static Memory &Get();
+
+    void Init();
+    void Exit();
+
+    /// @brief Sample all subsystems now
+    void Update();
+
+    orxU64 GetSize(Subsystem subsystem) const;
+    orxU64 GetPeakSize(Subsystem subsystem) const;
+
+    /// @brief Log current, peak & budget of all subsystems
+    void Report() const;
+
+  private:
+    struct Usage
+    {
+      orxU64 size{0};
+      orxU64 peak{0};
+      orxU64 budget{0};
+      bool over{false};
+    };
+
+    static orxSTATUS orxFASTCALL OnEvent(const orxEVENT *_pstEvent);
+
+    /// @brief Log what takes up most of a subsystem's memory
+    void LogOffenders(Subsystem subsystem) const;
+
+    Usage usages[static_cast<size_t>(Subsystem::Count)]{};
+
+    /// Last bundle sample, summed over its per-thread counters
+    orxBUNDLE_MEMORY_USAGE bundle{};
+
+    orxDOUBLE checkPeriod{0.0};
+    orxDOUBLE nextCheck{0.0};
+  };
+}
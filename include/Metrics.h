@@ -0,0 +1,108 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "planet.h"
+
+namespace game
+{
+  /// Named runtime metrics: counters (total & per frame), sampled gauges and
+  /// histograms of per-frame values
+  ///
+  /// Shown in an on-screen overlay (`Metrics.Show`, or the ToggleMetrics
+  /// input) and appended every `Metrics.DumpPeriod` seconds to
+  /// `Metrics.DumpFile`, as CSV or, for a `.json` file, one JSON object per
+  /// line. Registering a name twice returns the existing metric, so call
+  /// sites can register lazily.
+  class Metrics
+  {
+  public:
+    using Id = orxU32;
+
+    static Metrics &Get();
+
+    void Init();
+    void Exit();
+
+    Id AddCounter(const orxSTRING name);
+    /// @param sample Called whenever the gauge is shown or dumped
+    Id AddGauge(const orxSTRING name, std::function<orxDOUBLE()> sample);
+    /// @param bounds Ascending upper bounds of the buckets, values above the last one go to an extra bucket
+    Id AddHistogram(const orxSTRING name, std::vector<orxDOUBLE> bounds);
+
+    void Increment(Id counter, orxU32 amount = 1);
+    void Observe(Id histogram, orxDOUBLE value);
+
+    /// @brief Show or hide the overlay
+    void Show(bool show);
+    bool IsShown() const;
+
+    /// @brief Write all metrics to a new file
+    /// @param path File to write, `Metrics.DumpFile` from config if NULL
+    /// @return `true` on success
+    bool Dump(const orxSTRING path = orxNULL) const;
+
+  private:
+    struct Counter
+    {
+      const orxSTRING name;
+      orxU64 total{0};
+      orxU32 frame{0};
+      orxU32 last{0};
+    };
+
+    struct Gauge
+    {
+      const orxSTRING name;
+      std::function<orxDOUBLE()> sample;
+    };
+
+    struct Histogram
+    {
+      const orxSTRING name;
+      std::vector<orxDOUBLE> bounds;
+      std::vector<orxU32> buckets;
+      orxU32 count{0};
+      orxDOUBLE sum{0.0};
+      orxDOUBLE max{0.0};
+    };
+
+    static orxSTATUS orxFASTCALL OnEvent(const orxEVENT *_pstEvent);
+
+    /// @brief Close the current frame: feeds per-frame histograms, refreshes the overlay & dumps
+    void EndFrame();
+    void UpdateOverlay() const;
+
+    void WriteHeader(orxFILE *file, bool json) const;
+    void WriteRow(orxFILE *file, bool json) const;
+
+    std::vector<Counter> counters{};
+    std::vector<Gauge> gauges{};
+    std::vector<Histogram> histograms{};
+
+    // Built-in metrics, fed every frame
+    Id created{0};
+    Id merges{0};
+    Id bundleOpened{0};
+    Id bundleClosed{0};
+    Id frameTime{0};
+    Id createdPerFrame{0};
+    Id mergesPerFrame{0};
+
+    orxU32 bundleOpenCount{0};
+    orxU32 bundleCloseCount{0};
+
+    orxDOUBLE startTime{0.0};
+    orxDOUBLE frameStart{0.0};
+
+    orxOBJECT *overlay{orxNULL};
+    orxDOUBLE overlayPeriod{0.0};
+    orxDOUBLE nextOverlay{0.0};
+
+    orxFILE *dumpFile{orxNULL};
+    bool dumpJson{false};
+    orxDOUBLE dumpPeriod{0.0};
+    orxDOUBLE nextDump{0.0};
+  };
+}
@@ -20,9 +20,37 @@ private:
 
 namespace game
 {
+  /// Scene background, shows one of its `Choices` picked from the cosmetic
+  /// random stream, so it changes every game but replays identically
+  ///
+  /// An `Alpha` set on the background overrides the picked one's.
+  class Background : public Object
+  {
+  protected:
+    void OnCreate();
+  };
+
+  class GameScene : public Object
+  {
+  public:
+  protected:
+    void OnCreate();
+    void OnDelete();
+  };
+
   class Planet : public Object
   {
   public:
+    /// Planet state saved in snapshots, on top of its physics
+    struct State
+    {
+      /// Time spent touching the arena top, none if not touching
+      std::optional<orxFLOAT> touchingArenaTop{};
+    };
+
+    State GetState() const;
+    void SetState(const State &state);
+
   protected:
     void OnCreate();
     void OnDelete();
@@ -47,19 +75,44 @@ namespace game
   class Dropper : public Object
   {
   public:
+    /// Dropper state saved in snapshots
+    struct State
+    {
+      orxFLOAT x{0.0};
+      orxFLOAT dtSinceDrop{0.0};
+      bool first{true};
+      /// Model name of the held planet, empty if none
+      const orxSTRING held{orxSTRING_EMPTY};
+    };
+
+    State GetState() const;
+    void SetState(const State &state);
+
   protected:
     void OnCreate();
     void OnDelete();
     void Update(const orxCLOCK_INFO &_rstInfo);
 
   private:
-    void UpdatePosition(const orxCLOCK_INFO &_rstInfo);
+    void UpdatePosition(const orxCLOCK_INFO &_rstInfo, orxFLOAT xDirection);
 
-    void CreatePlanet();
+    void CreatePlanet(const orxSTRING name);
     void DropPlanet();
 
     bool first{true};
     orxOBJECT *latest{orxNULL};
     orxFLOAT dtSinceDrop{0.0};
   };
+
+  /// Score display, only re-laid out when the score changes
+  class Score : public Object
+  {
+  protected:
+    void OnCreate();
+    void Update(const orxCLOCK_INFO &_rstInfo);
+
+  private:
+    const orxSTRING font{orxSTRING_EMPTY};
+    std::optional<orxU32> shown{};
+  };
 }
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "Object.h"
+
+namespace game
+{
+  /// Lightweight particles kept in packed arrays, one per property, and drawn
+  /// as a single batched mesh instead of one orx object each
+  ///
+  /// Bursts are described by emitter sections (`Particle` and `Count` keys);
+  /// the particle section uses the usual object keys: `Graphic`, `Size`,
+  /// `Rotation`, `AngularVelocity`, `Speed`, `UseRelativeSpeed`, `Color`,
+  /// `Alpha` and `LifeTime`. Each key can be a single value or a `~` range,
+  /// `Color` can also be a list. Sections are read once and cached.
+  class Particles
+  {
+  public:
+    static Particles &Get();
+
+    void Init();
+    void Exit();
+
+    /// @brief Emit a burst of particles
+    /// @param emitter Emitter config section
+    /// @param position World position of the burst
+    void Emit(const orxSTRING emitter, const orxVECTOR &position);
+
+    /// @brief Move all particles and remove the expired ones
+    void Update(orxFLOAT dt);
+
+    /// @brief Draw all particles
+    /// @param transform Display transform of a reference object, without pivot
+    /// @param origin World position of that reference object
+    void Render(const orxDISPLAY_TRANSFORM &transform, const orxVECTOR &origin) const;
+
+    /// @brief Remove all particles and forget cached config
+    void Clear();
+
+    orxU32 GetCount() const;
+
+  private:
+    struct Range
+    {
+      orxVECTOR min{};
+      orxVECTOR max{};
+    };
+
+    /// Emitter & particle config, resolved once
+    struct Emitter
+    {
+      orxU32 count{0};
+      orxTEXTURE *texture{orxNULL};
+      Range size{};
+      Range rotation{};
+      Range angularVelocity{};
+      Range speed{};
+      Range alpha{};
+      Range lifeTime{};
+      bool relativeSpeed{false};
+      std::vector<orxRGBA> colors{};
+    };
+
+    /// @brief Read a single value or a `min ~ max` range from the current section
+    /// @param fallback Value used when the key is missing or invalid
+    static Range ReadRange(const orxSTRING key, const orxVECTOR &fallback);
+
+    const Emitter &GetEmitter(const orxSTRING name);
+    void Resize(size_t count);
+
+    std::map<orxSTRINGID, Emitter> emitters{};
+
+    // Particle properties, one array each so updates stay branchless & vectorizable
+    std::vector<orxFLOAT> x{};
+    std::vector<orxFLOAT> y{};
+    std::vector<orxFLOAT> vx{};
+    std::vector<orxFLOAT> vy{};
+    std::vector<orxFLOAT> rotation{};
+    std::vector<orxFLOAT> angularVelocity{};
+    std::vector<orxFLOAT> halfWidth{};
+    std::vector<orxFLOAT> halfHeight{};
+    std::vector<orxFLOAT> timeLeft{};
+    std::vector<orxRGBA> color{};
+    std::vector<orxTEXTURE *> texture{};
+
+    // Render scratch buffers
+    mutable std::vector<orxDISPLAY_VERTEX> vertices{};
+    std::vector<orxU16> indices{};
+  };
+
+  /// Scene object that steps and draws the particles, in place of its own graphic
+  class ParticleField : public Object
+  {
+  protected:
+    void OnCreate();
+    void OnDelete();
+    void Update(const orxCLOCK_INFO &_rstInfo);
+    orxBOOL OnRender(orxRENDER_EVENT_PAYLOAD &_rstPayload);
+  };
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <map>
+#include <utility>
+
+#include "Trace.h"
+#include "planet.h"
+
+namespace game
+{
+  /// Hot-path instrumentation for profiler builds
+  ///
+  /// `PROFILE_SCOPE(Name)` holds an orx profiler marker for the rest of the
+  /// enclosing scope. `PROFILE_MODEL(Object, Kind)` adds the scope's time
+  /// to the object's model in a per-model table, shown in the console with
+  /// `Profiler.Show` (or the ShowModelProfile input) and written out with
+  /// `Profiler.Dump`. Both also add spans to a recording trace (see Trace.h),
+  /// and compile to nothing without `__orxPROFILER__`.
+  class Profiler
+  {
+  public:
+    enum class Kind
+    {
+      Update,
+      Collide,
+      Count
+    };
+
+    static Profiler &Get();
+
+    void Init();
+    void Exit();
+
+#ifdef __orxPROFILER__
+    /// @brief Add a timed call to a model's totals
+    void Record(orxSTRINGID model, Kind kind, orxDOUBLE duration);
+
+    /// @brief Log the per-model table, slowest models first
+    void Show() const;
+
+    /// @brief Write the per-model table as CSV
+    /// @param path File to write, `Profiler.File` from config if NULL
+    /// @return `true` on success
+    bool Dump(const orxSTRING path = orxNULL) const;
+
+    void Reset();
+
+  private:
+    struct Entry
+    {
+      orxU32 count{0};
+      orxDOUBLE total{0.0};
+      orxDOUBLE max{0.0};
+    };
+
+    using Key = std::pair<orxSTRINGID, Kind>;
+
+    std::map<Key, Entry> entries{};
+#endif // __orxPROFILER__
+  };
+
+#ifdef __orxPROFILER__
+
+  /// Pushes a profiler marker, popped when going out of scope
+  class ProfileScope
+  {
+  public:
+    ProfileScope(orxS32 &id, const orxSTRING name)
+        : name(name), start(Trace::Get().IsRecording() ? orxSystem_GetTime() : 0.0)
+    {
+      if (!orxProfiler_IsMarkerIDValid(id))
+      {
+        id = orxProfiler_GetIDFromName(name);
+      }
+      orxProfiler_PushMarker(id);
+    }
+
+    ~ProfileScope()
+    {
+      orxProfiler_PopMarker();
+
+      if (Trace::Get().IsRecording())
+      {
+        Trace::Get().Complete(name, "game", start, orxSystem_GetTime());
+      }
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+  private:
+    const orxSTRING name;
+    orxDOUBLE start;
+  };
+
+  /// Times a scope and records it against an object's model
+  class ModelScope
+  {
+  public:
+    ModelScope(const ScrollObject &object, Profiler::Kind kind)
+        : model(orxString_GetID(object.GetModelName())), kind(kind), start(orxSystem_GetTime())
+    {
+    }
+
+    ~ModelScope()
+    {
+      const auto end = orxSystem_GetTime();
+      Profiler::Get().Record(model, kind, end - start);
+
+      if (Trace::Get().IsRecording())
+      {
+        Trace::Get().Complete(orxString_GetFromID(model), (kind == Profiler::Kind::Update) ? "update" : "collide", start, end);
+      }
+    }
+
+    ModelScope(const ModelScope &) = delete;
+    ModelScope &operator=(const ModelScope &) = delete;
+
+  private:
+    orxSTRINGID model;
+    Profiler::Kind kind;
+    orxDOUBLE start;
+  };
+
+#endif // __orxPROFILER__
+}
+
+#ifdef __orxPROFILER__
+
+#define PROFILE_CONCAT_(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_(A, B)
+
+#define PROFILE_SCOPE(NAME)                                                                       \
+  static orxS32 PROFILE_CONCAT(profileMarker, __LINE__) = orxPROFILER_KS32_MARKER_ID_NONE;        \
+  const game::ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(PROFILE_CONCAT(profileMarker, __LINE__), NAME)
+
+#define PROFILE_MODEL(OBJECT, KIND) \
+  const game::ModelScope PROFILE_CONCAT(modelScope, __LINE__)((OBJECT), game::Profiler::Kind::KIND)
+
+#else // __orxPROFILER__
+
+#define PROFILE_SCOPE(NAME)
+#define PROFILE_MODEL(OBJECT, KIND)
+
+#endif // __orxPROFILER__
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "planet.h"
+
+namespace game
+{
+  /// Small, fast PCG32 generator
+  class RandomStream
+  {
+  public:
+    void Seed(orxU64 seed, orxU64 sequence);
+
+    orxU32 Next();
+
+    /// @brief Uniform index in `[0, count)`
+    orxU32 NextIndex(orxU32 count);
+
+    /// @brief Uniform value in `[min, max)`
+    orxFLOAT NextFloat(orxFLOAT min, orxFLOAT max);
+
+  private:
+    orxU64 state{0};
+    orxU64 increment{1};
+  };
+
+  /// Per-game seeded randomness, split into independent substreams so that
+  /// cosmetic effects never shift gameplay outcomes (and vice versa)
+  ///
+  /// The cosmetic stream also seeds orx's global generator, which resolves
+  /// config lists (`#`) and ranges (`~`). The seed comes from `Random.Seed`
+  /// in config, or from the clock when unset, and is logged on each reset so
+  /// any run can be reproduced.
+  class Random
+  {
+  public:
+    enum class Stream
+    {
+      Gameplay,
+      Cosmetic
+    };
+
+    static Random &Get();
+
+    void Init();
+    void Exit();
+
+    /// @brief Reseed all streams
+    /// @param requested Seed to use, 0 for the configured one (or a fresh one if unset)
+    /// @return The seed in use
+    orxU64 Reset(orxU64 requested = 0);
+    orxU64 GetSeed() const;
+
+    RandomStream &GetStream(Stream stream);
+
+    /// @brief Pick an item of a config list of the current section
+    /// @return The picked item, or an empty string if the list is empty
+    const orxSTRING PickListString(Stream stream, const orxSTRING key);
+
+  private:
+    orxU64 seed{0};
+    RandomStream gameplay{};
+    RandomStream cosmetic{};
+  };
+}
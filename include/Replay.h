@@ -0,0 +1,91 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "planet.h"
+
+namespace game
+{
+  /// Dropper inputs sampled for a single fixed update
+  struct ReplayInput
+  {
+    orxFLOAT left{0.0};
+    orxFLOAT right{0.0};
+    /// Pressed since the previous update
+    bool drop{false};
+    /// Pressed since the previous update
+    bool gameOver{false};
+  };
+
+  /// Records game sessions (random seed, fixed updates per frame, dropper
+  /// inputs per update and drop choices) and plays them back at full speed
+  /// without rendering
+  ///
+  /// Configured from the `Replay` section: `Record` and `Play` are file paths.
+  /// Requires fixed-step updates as the recording is made of update counts.
+  class Replay
+  {
+  public:
+    static Replay &Get();
+
+    /// @brief Read config and set up recording or playback
+    /// @return `true` if a session should be played back instead of starting normally
+    bool Init();
+    void Exit();
+
+    bool IsRecording() const;
+    bool IsPlaying() const;
+
+    /// Game session boundaries, called when the game scene is created/deleted
+    void StartSession();
+    void StopSession();
+
+    /// @brief Sample dropper inputs for the current fixed update
+    /// @return Live inputs from the current input set, with presses latched
+    /// every frame until an update consumes them, or recorded ones during playback
+    ReplayInput SampleInput();
+
+    /// @brief Choose the next planet from the `Drop` list of the current config section
+    /// @return Live random choice, or recorded one during playback
+    const orxSTRING ChooseDrop();
+
+  private:
+    enum class Mode
+    {
+      Off,
+      Record,
+      Play
+    };
+
+    void Save() const;
+    bool Load();
+    void SetNextFrameDT(orxU32 updates) const;
+
+    static void orxFASTCALL OnClockUpdate(const orxCLOCK_INFO *_pstInfo, void *_pContext);
+    static void orxFASTCALL OnClockInput(const orxCLOCK_INFO *_pstInfo, void *_pContext);
+
+    Mode mode{Mode::Off};
+    bool inSession{false};
+    std::string path{};
+    orxU64 seed{0};
+
+    // Live presses not yet consumed by an update
+    bool dropLatched{false};
+    bool gameOverLatched{false};
+
+    // Session data
+    std::vector<orxU8> frames{};
+    std::vector<ReplayInput> inputs{};
+    std::vector<std::string> drops{};
+
+    // Recording state
+    orxU32 inputsThisFrame{0};
+
+    // Playback state
+    size_t frameIndex{0};
+    size_t inputIndex{0};
+    size_t dropIndex{0};
+    orxDOUBLE startTime{0.0};
+  };
+}
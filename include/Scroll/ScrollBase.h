@@ -127,11 +127,21 @@ class ScrollObjectBinderBase
 {
   friend class ScrollBase;
 
+public:
+
+  static        void                    GetBankUsage(orxU32 &_ru32BinderCount, orxU64 &_ru64UsedSize, orxU64 &_ru64ReservedSize);
+  static        void                    LogBankUsage();
+
+
 protected:
 
   static        orxHASHTABLE *          GetTable();
   static        void                    DeleteTable();
-  static        ScrollObjectBinderBase *GetBinder(const orxSTRING _zName, orxBOOL _bAllowDefault = orxTRUE);
+  static        ScrollObjectBinderBase *GetBinder(const orxSTRING _zName, orxBOOL _bAllowDefault = orxTRUE, orxBOOL _bCheckBind = orxFALSE);
+  static        void                    ClearModelTable();
+  static        void                    GetBankConfig(const orxSTRING _zName, orxS32 &_rs32SegmentSize, orxU32 &_ru32ReserveCount);
+
+                void                    SetupBank(const orxSTRING _zName, orxU32 _u32ReserveCount);
 
                                         ScrollObjectBinderBase(orxS32 _s32SegmentSize, orxU32 _u32ElementSize);
   virtual                              ~ScrollObjectBinderBase();
@@ -139,7 +149,22 @@ protected:
 
 private:
 
+  //! Per-model binding & creation info, cached as it only depends on config
+  struct ModelInfo
+  {
+    ScrollObjectBinderBase *            poBinder;
+    const orxSTRING                     zInputSet;
+    orxBOOL                             bBind;
+    orxBOOL                             bPausable;
+    orxBOOL                             bInputReady;
+  };
+
   static        ScrollObjectBinderBase *GetDefaultBinder();
+  static        ModelInfo *             GetModelInfo(const orxSTRING _zModelName);
+
+  static        void                    VisitBinders(void (*_pfnVisit)(ScrollObjectBinderBase *_poBinder, void *_pContext), void *_pContext);
+
+                void                    Reserve(orxU32 _u32Count);
 
                 ScrollObject *          CreateObject(const orxSTRING _zModelName, const orxSTRING _zInstanceName, ScrollObject::Flag _xFlags);
                 ScrollObject *          CreateObject(orxOBJECT *_pstOrxObject, const orxSTRING _zInstanceName, ScrollObject::Flag _xFlags);
@@ -158,9 +183,17 @@ private:
   static  const orxU32                  su32TableSize;
 
                 orxBANK *               mpstBank;
+                const orxSTRING         mzName;
+                orxU32                  mu32SegmentSize;
+                orxU32                  mu32ElementSize;
+                orxU32                  mu32Capacity;
+                orxU32                  mu32PeakCount;
+                orxU32                  mu32GrowthCount;
                 ScrollObject *          mpoFirstObject;
                 ScrollObject *          mpoLastObject;
   static        orxHASHTABLE *          spstTable;
+  static        orxHASHTABLE *          spstModelTable;
+  static        orxBANK *               spstModelBank;
 
 };
 
@@ -215,12 +248,27 @@ ScrollObjectBinder<O> *ScrollObjectBinder<O>::GetInstance(orxS32 _s32SegmentSize
 template<class O>
 void ScrollObjectBinder<O>::Register(const orxSTRING _zName, orxS32 _s32SegmentSize)
 {
+  ScrollObjectBinder<O> *poBinder;
+  orxU32                 u32ReserveCount;
+
   // Checks
   orxASSERT(!orxHashTable_Get(ScrollObjectBinderBase::GetTable(), orxString_Hash(_zName)));
   orxASSERT(_s32SegmentSize > 0);
 
+  // Gets bank config
+  GetBankConfig(_zName, _s32SegmentSize, u32ReserveCount);
+
+  // Gets binder
+  poBinder = GetInstance(_s32SegmentSize);
+
   // Adds binder to table
-  orxHashTable_Add(GetTable(), orxString_Hash(_zName ? _zName : orxSTRING_EMPTY), GetInstance(_s32SegmentSize));
+  orxHashTable_Add(GetTable(), orxString_Hash(_zName ? _zName : orxSTRING_EMPTY), poBinder);
+
+  // Sets up its bank
+  poBinder->SetupBank(_zName, u32ReserveCount);
+
+  // Clears cached model info
+  ClearModelTable();
 }
 
 template<class O>
@@ -263,10 +311,20 @@ inline static void ScrollBindObject(const orxSTRING _zName, orxS32 _s32SegmentSi
 class ScrollBase
 {
   friend class ScrollEd;
+  friend class ScrollObject;
   friend class ScrollObjectBinderBase;
 
 public:
 
+  //! Frame memory stats, sizes in bytes
+  struct FrameMemoryStats
+  {
+    orxU32      u32Size;                // Allocated during the last frame
+    orxU32      u32PeakSize;
+    orxU32      u32Capacity;
+    orxU32      u32OverflowCount;       // Allocations that didn't fit & got their own block
+  };
+
   static        ScrollBase &    GetInstance();
                 void            Execute(int argc, char **argv);
 
@@ -278,6 +336,15 @@ public:
 
                 orxU32          GetFrameCount() const;
 
+                void *          AllocateFrameMemory(orxU32 _u32Size, orxU32 _u32Alignment = 8);
+          template<class T> T * AllocateFrameArray(orxU32 _u32Count)       {return (T *)AllocateFrameMemory(_u32Count * (orxU32)sizeof(T), (orxU32)alignof(T));}
+          const FrameMemoryStats &GetFrameMemoryStats() const;
+
+                orxBOOL         IsFixedStep() const;
+                orxFLOAT        GetFixedStepDT() const;
+                orxFLOAT        GetFixedStepAlpha() const;
+                orxU32          GetFixedStepCount() const;
+
                 orxVIEWPORT *   GetMainViewport() const;
                 orxCAMERA *     GetMainCamera() const;
                 ScrollObject *  GetObject(orxU64 _u64GUID) const;
@@ -293,6 +360,9 @@ public:
                 ScrollObject *  PickObject(const orxVECTOR &_rvPosition, const orxVECTOR &_rvExtent, orxSTRINGID _u32GroupID = orxSTRINGID_UNDEFINED) const;
                 ScrollObject *  PickObject(const orxOBOX &_rstBox, orxSTRINGID _stGroupID = orxSTRINGID_UNDEFINED) const;
 
+                //! Converts a text map to the binary format, also available as the Scroll.CompileMap command
+                orxSTATUS       CompileMap(const orxSTRING _zSourceName, const orxSTRING _zDestinationName);
+
 
 
 protected:
@@ -305,6 +375,7 @@ protected:
           const orxSTRING       GetMapShortName() const;
                 orxSTATUS       LoadMap();
                 orxSTATUS       SaveMap(orxBOOL _bEncrypt = orxFALSE, const orxCONFIG_SAVE_FUNCTION _pfnMapSaveFilter = orxNULL);
+                orxSTATUS       SaveBinaryMap(const orxSTRING _zFileName);
                 orxSTATUS       ResetMap();
                 ScrollObject *  CreateObject(const orxSTRING _zModelName, ScrollObject::Flag _xFlags = ScrollObject::FlagNone, const orxSTRING _zInstanceName = orxNULL);
                 ScrollObject *  CreateObject(orxOBJECT *_pstOrxObject, ScrollObject::Flag _xFlags = ScrollObject::FlagNone, const orxSTRING _zInstanceName = orxNULL);
@@ -326,6 +397,12 @@ protected:
                 orxBOOL         IsDifferentialMode() const;
 
   static  const orxSTRING       szConfigClockFrequency;
+  static  const orxSTRING       szConfigSectionFixedStep;
+  static  const orxSTRING       szConfigFixedStepFrequency;
+  static  const orxSTRING       szConfigFixedStepMaxStepCount;
+  static  const orxSTRING       szConfigSectionFrameMemory;
+  static  const orxSTRING       szConfigFrameMemorySize;
+  static  const orxSTRING       szConfigFrameMemoryPoison;
 
   static  const orxSTRING       szInputSetGame;
   static  const orxSTRING       szConfigSectionMap;
@@ -349,14 +426,63 @@ protected:
   static  const orxSTRING       szConfigScrollObjectSmoothing;
   static  const orxSTRING       szConfigScrollObjectTiling;
   static  const orxSTRING       szConfigScrollObjectPausable;
+  static  const orxSTRING       szConfigScrollObjectBind;
   static  const orxSTRING       szConfigScrollObjectInput;
+  static  const orxSTRING       szConfigScrollObjectBankSegmentSize;
+  static  const orxSTRING       szConfigScrollObjectBankReserve;
   static  const orxSTRING       szConfigScrollObjectOnInput;
   static  const orxCHAR         scConfigScrollObjectInstantMarker   = '.';
   static  const orxCHAR         scConfigScrollObjectNegativeMarker  = '-';
+  static  const orxU32          su32BinaryMapTag                    = 0x32424D53; // "SMB2"
+  static  const orxU32          su32FrameMemoryDefaultSize          = 64 * 1024;
+  static  const orxU32          su32FrameMemoryHeaderSize           = 16;
+  static  const orxU8           su8FrameMemoryPoison                = 0xDD;
 
 
 private:
 
+  //! Binary map flags
+  enum BinaryMapFlag
+  {
+    BinaryMapFlagNone             = 0x00000000,
+
+    BinaryMapFlagDifferential     = 0x00000001,
+    BinaryMapFlagLayerNumber      = 0x00000002,
+    BinaryMapFlagCameraPosition   = 0x00000004,
+    BinaryMapFlagCameraZoom       = 0x00000008,
+
+    BinaryMapFlagPosition         = 0x00000010,
+    BinaryMapFlagScale            = 0x00000020,
+    BinaryMapFlagColor            = 0x00000040,
+    BinaryMapFlagSmoothing        = 0x00000080,
+    BinaryMapFlagTiling           = 0x00000100
+  };
+
+  //! Binary map header, followed by the string table (zero-padded to the records' alignment) and the object records (native endianness)
+  struct BinaryMapHeader
+  {
+    orxU32      u32Tag;
+    orxU32      u32Flags;
+    orxU32      u32LayerNumber;
+    orxVECTOR   vCameraPosition;
+    orxFLOAT    fCameraZoom;
+    orxU32      u32NextObjectID;
+    orxU32      u32StringTableSize;
+    orxU32      u32RecordNumber;
+  };
+
+  //! Binary map object record, model names are offsets in the string table
+  struct BinaryMapRecord
+  {
+    orxU32      u32ID;
+    orxU32      u32ModelOffset;
+    orxU32      u32Flags;
+    orxFLOAT    fRotation;
+    orxVECTOR   vPosition;
+    orxVECTOR   vScale;
+    orxCOLOR    stColor;
+  };
+
   virtual       orxSTATUS       Init() = 0;
   virtual       orxSTATUS       Run() = 0;
   virtual       void            Exit() = 0;
@@ -380,11 +506,16 @@ private:
                 orxSTATUS       BaseInit();
                 orxSTATUS       BaseRun();
                 void            BaseExit();
-                void            BaseUpdate(const orxCLOCK_INFO &_rstInfo);
+                void            BaseUpdate(const orxCLOCK_INFO &_rstInfo, orxU32 _u32StepCount);
                 void            BaseCameraUpdate(const orxCLOCK_INFO &_rstInfo);
+                void            ResetFrameMemory();
                 orxBOOL         BaseMapSaveFilter(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption);
                 orxSTRING       GetNewObjectName(orxCHAR _zName[32], orxBOOL bRunTime = orxFALSE);
 
+                orxHANDLE       OpenBinaryMap(const orxSTRING _zMapName, BinaryMapHeader &_rstHeader) const;
+                orxSTATUS       LoadBinaryMap(orxHANDLE _hResource, const BinaryMapHeader &_rstHeader);
+                orxSTATUS       WriteBinaryMap(const orxSTRING _zFileName, BinaryMapHeader &_rstHeader, BinaryMapRecord *_astRecordList, const orxSTRING *_azModelList) const;
+
 
   static  void                  DeleteInstance();
 
@@ -393,6 +524,8 @@ private:
   static  void      orxFASTCALL StaticExit();
   static  void      orxFASTCALL StaticUpdate(const orxCLOCK_INFO *_pstInfo, void *_pstContext);
   static  void      orxFASTCALL StaticCameraUpdate(const orxCLOCK_INFO *_pstInfo, void *_pstContext);
+  static  void      orxFASTCALL StaticResetFrameMemory(const orxCLOCK_INFO *_pstInfo, void *_pstContext);
+  static  void      orxFASTCALL StaticCompileMapCommand(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult);
   static  orxBOOL   orxFASTCALL StaticMapSaveFilter(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption);
   static  orxSTATUS orxFASTCALL StaticEventHandler(const orxEVENT *_pstEvent);
   static  orxSTATUS orxFASTCALL StaticBootstrap();
@@ -413,10 +546,20 @@ private:
                 orxVIEWPORT *   mpstMainViewport;
                 orxCAMERA *     mpstMainCamera;
                 orxCONFIG_SAVE_FUNCTION mpfnCustomMapSaveFilter;
+                orxU8 *         mpu8FrameMemory;
+                void *          mpFrameMemoryOverflow;
+                FrameMemoryStats mstFrameMemoryStats;
+                orxU32          mu32FrameMemoryCursor;
+                orxU32          mu32FrameMemoryOverflowSize;
+                orxBOOL         mbFrameMemoryPoison;
                 orxU32          mu32NextObjectID;
                 orxU32          mu32RuntimeObjectID;
                 orxU32          mu32LayerNumber;
                 orxU32          mu32FrameCount;
+                orxU32          mu32FixedStepMaxCount;
+                orxU32          mu32FixedStepCount;
+                orxFLOAT        mfFixedStepDT;
+                orxFLOAT        mfFixedStepAccumulator;
                 orxBOOL         mbEditorMode;
                 orxBOOL         mbDifferentialMode;
                 orxBOOL         mbObjectListLocked;
@@ -481,6 +624,11 @@ O *ScrollBase::GetPreviousObject(const O *_poObject) const
 }
 
 
+// Template static, defined here as each unit using a binder instantiates it
+template<class O>
+ScrollObjectBinder<O> *ScrollObjectBinder<O>::spoInstance     = orxNULL;
+
+
 #ifdef __SCROLL_IMPL__
 
 #include <stddef.h>
@@ -498,6 +646,12 @@ O *ScrollBase::GetPreviousObject(const O *_poObject) const
 //! Constants
 const orxSTRING ScrollBase::szInputSetGame                    = "ScrollInput";
 const orxSTRING ScrollBase::szConfigClockFrequency            = "ClockFrequency";
+const orxSTRING ScrollBase::szConfigSectionFixedStep          = "FixedStep";
+const orxSTRING ScrollBase::szConfigFixedStepFrequency        = "Frequency";
+const orxSTRING ScrollBase::szConfigFixedStepMaxStepCount     = "MaxStepCount";
+const orxSTRING ScrollBase::szConfigSectionFrameMemory        = "FrameMemory";
+const orxSTRING ScrollBase::szConfigFrameMemorySize           = "Size";
+const orxSTRING ScrollBase::szConfigFrameMemoryPoison         = "Poison";
 const orxSTRING ScrollBase::szConfigSectionMap                = "Map";
 const orxSTRING ScrollBase::szConfigMainViewport              = "MainViewport";
 const orxSTRING ScrollBase::szConfigCameraPosition            = "CameraPosition";
@@ -519,16 +673,16 @@ const orxSTRING ScrollBase::szConfigScrollObjectAlpha         = "Alpha";
 const orxSTRING ScrollBase::szConfigScrollObjectSmoothing     = "Smoothing";
 const orxSTRING ScrollBase::szConfigScrollObjectTiling        = "Tiling";
 const orxSTRING ScrollBase::szConfigScrollObjectPausable      = "Pausable";
+const orxSTRING ScrollBase::szConfigScrollObjectBind          = "Bind";
 const orxSTRING ScrollBase::szConfigScrollObjectInput         = "Input";
+const orxSTRING ScrollBase::szConfigScrollObjectBankSegmentSize = "BankSegmentSize";
+const orxSTRING ScrollBase::szConfigScrollObjectBankReserve   = "BankReserve";
 const orxSTRING ScrollBase::szConfigScrollObjectOnInput       = "OnInput";
 
 
 //! Static variables
 ScrollBase *ScrollBase::spoInstance                           = orxNULL;
 
-template<class O>
-ScrollObjectBinder<O> *ScrollObjectBinder<O>::spoInstance     = orxNULL;
-
 
 //! Code
 ScrollBase &ScrollBase::GetInstance()
@@ -541,7 +695,9 @@ ScrollBase &ScrollBase::GetInstance()
 
 ScrollBase::ScrollBase() : mzMapName(orxNULL), mzCurrentCreateObject(orxNULL), mzCurrentDeleteObject(orxNULL),
                            mpstMainViewport(orxNULL), mpstMainCamera(orxNULL), mpfnCustomMapSaveFilter(orxNULL),
+                           mpu8FrameMemory(orxNULL), mpFrameMemoryOverflow(orxNULL), mstFrameMemoryStats(), mu32FrameMemoryCursor(0), mu32FrameMemoryOverflowSize(0), mbFrameMemoryPoison(orxFALSE),
                            mu32NextObjectID(0), mu32RuntimeObjectID(0), mu32LayerNumber(1), mu32FrameCount(0),
+                           mu32FixedStepMaxCount(0), mu32FixedStepCount(0), mfFixedStepDT(orxFLOAT_0), mfFixedStepAccumulator(orxFLOAT_0),
                            mbEditorMode(orxFALSE), mbDifferentialMode(orxFALSE), mbObjectListLocked(orxFALSE), mbIsRunning(orxFALSE), mbIsPaused(orxFALSE)
 {
 }
@@ -586,7 +742,7 @@ ScrollObject *ScrollBase::CreateObject(const orxSTRING _zModelName, ScrollObject
     mzCurrentCreateObject = _zModelName;
 
     // Uses it
-    poResult = poBinder->CreateObject(_zModelName, _zInstanceName ? _zInstanceName : GetNewObjectName(zInstanceName, (_xFlags & ScrollObject::FlagRunTime) ? orxTRUE : orxFALSE), _xFlags);
+    poResult = poBinder->CreateObject(_zModelName, (_zInstanceName || (_xFlags & ScrollObject::FlagRunTime)) ? _zInstanceName : GetNewObjectName(zInstanceName), _xFlags);
 
     // Restores previous object
     mzCurrentCreateObject = zPreviousObject;
@@ -646,7 +802,7 @@ ScrollObject *ScrollBase::CreateObject(orxOBJECT *_pstOrxObject, ScrollObject::F
     poBinder = ScrollObjectBinderBase::GetBinder(zObjectName);
 
     // Uses it
-    poResult = poBinder->CreateObject(_pstOrxObject, _zInstanceName ? _zInstanceName : GetNewObjectName(zInstanceName, (_xFlags & ScrollObject::FlagRunTime) ? orxTRUE : orxFALSE), _xFlags);
+    poResult = poBinder->CreateObject(_pstOrxObject, (_zInstanceName || (_xFlags & ScrollObject::FlagRunTime)) ? _zInstanceName : GetNewObjectName(zInstanceName), _xFlags);
 
     // Valid?
     if(poResult)
@@ -926,9 +1082,11 @@ const orxSTRING ScrollBase::GetMapShortName() const
 
 orxSTATUS ScrollBase::LoadMap()
 {
-  orxCHAR   acBuffer[32];
-  orxU32    i;
-  orxSTATUS eResult;
+  orxCHAR         acBuffer[32];
+  BinaryMapHeader stHeader;
+  orxHANDLE       hResource;
+  orxU32          i;
+  orxSTATUS       eResult;
 
   // Object list not locked and has a valid map name?
   if(!mbObjectListLocked && mzMapName && (mzMapName != orxSTRING_EMPTY))
@@ -949,8 +1107,17 @@ orxSTATUS ScrollBase::LoadMap()
       }
     }
 
+    // Is it a binary map?
+    if((hResource = OpenBinaryMap(mzMapName, stHeader)) != orxHANDLE_UNDEFINED)
+    {
+      // Loads it
+      eResult = LoadBinaryMap(hResource, stHeader);
+
+      // Closes it
+      orxResource_Close(hResource);
+    }
     // Loads map
-    if(orxConfig_Load(mzMapName))
+    else if(orxConfig_Load(mzMapName))
     {
       orxS32 s32ScrollObjectCount, s32ScrollObjectNumber;
 
@@ -1213,6 +1380,595 @@ orxSTATUS ScrollBase::SaveMap(orxBOOL _bEncrypt, const orxCONFIG_SAVE_FUNCTION _
   return eResult;
 }
 
+orxSTATUS ScrollBase::SaveBinaryMap(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Valid?
+  if(_zFileName && (*_zFileName != orxCHAR_NULL))
+  {
+    ScrollObject     *poObject;
+    BinaryMapHeader   stHeader;
+    BinaryMapRecord  *astRecordList;
+    const orxSTRING  *azModelList;
+    orxU32            u32Count;
+
+    // Counts savable objects
+    for(poObject = GetNextObject(), u32Count = 0;
+        poObject;
+        poObject = GetNextObject(poObject))
+    {
+      // Should save it?
+      if(poObject->TestFlags(ScrollObject::FlagSave))
+      {
+        // Updates count
+        u32Count++;
+      }
+    }
+
+    // Inits header
+    orxMemory_Zero(&stHeader, sizeof(BinaryMapHeader));
+    stHeader.u32Tag           = su32BinaryMapTag;
+    stHeader.u32Flags         = BinaryMapFlagLayerNumber | BinaryMapFlagCameraPosition | BinaryMapFlagCameraZoom | (mbDifferentialMode ? BinaryMapFlagDifferential : BinaryMapFlagNone);
+    stHeader.u32LayerNumber   = mu32LayerNumber;
+    stHeader.fCameraZoom      = orxCamera_GetZoom(mpstMainCamera);
+    stHeader.u32NextObjectID  = mu32NextObjectID;
+    stHeader.u32RecordNumber  = u32Count;
+    orxCamera_GetPosition(mpstMainCamera, &stHeader.vCameraPosition);
+
+    // Allocates records & model names
+    astRecordList = (BinaryMapRecord *)orxMemory_Allocate(orxMAX(u32Count, 1) * sizeof(BinaryMapRecord), orxMEMORY_TYPE_TEMP);
+    azModelList   = (const orxSTRING *)orxMemory_Allocate(orxMAX(u32Count, 1) * sizeof(orxSTRING), orxMEMORY_TYPE_TEMP);
+    orxMemory_Zero(astRecordList, orxMAX(u32Count, 1) * sizeof(BinaryMapRecord));
+
+    // For all objects
+    for(poObject = GetNextObject(), u32Count = 0;
+        poObject;
+        poObject = GetNextObject(poObject))
+    {
+      // Should save it?
+      if(poObject->TestFlags(ScrollObject::FlagSave))
+      {
+        BinaryMapRecord  *pstRecord;
+        orxOBJECT        *pstOrxObject;
+
+        // Gets internal object & record
+        pstOrxObject  = poObject->GetOrxObject();
+        pstRecord     = &astRecordList[u32Count];
+
+        // Stores its ID, from its name
+        orxString_ToU32(poObject->GetName() + orxString_GetLength(szConfigScrollObjectPrefix), &pstRecord->u32ID, orxNULL);
+
+        // Stores all its properties
+        azModelList[u32Count] = poObject->GetModelName();
+        if(orxObject_GetPosition(pstOrxObject, &pstRecord->vPosition))
+        {
+          pstRecord->u32Flags |= BinaryMapFlagPosition;
+        }
+        if(orxObject_GetScale(pstOrxObject, &pstRecord->vScale))
+        {
+          pstRecord->u32Flags |= BinaryMapFlagScale;
+        }
+        pstRecord->fRotation = orxObject_GetRotation(pstOrxObject);
+        if(GetObjectConfigColor(poObject, pstRecord->stColor))
+        {
+          pstRecord->u32Flags |= BinaryMapFlagColor;
+        }
+        if(poObject->TestFlags(ScrollObject::FlagSmoothed))
+        {
+          pstRecord->u32Flags |= BinaryMapFlagSmoothing;
+        }
+        if(poObject->TestFlags(ScrollObject::FlagTiled))
+        {
+          pstRecord->u32Flags |= BinaryMapFlagTiling;
+        }
+
+        // Updates count
+        u32Count++;
+      }
+    }
+
+    // Writes map
+    eResult = WriteBinaryMap(_zFileName, stHeader, astRecordList, azModelList);
+
+    // Frees records & model names
+    orxMemory_Free(astRecordList);
+    orxMemory_Free((void *)azModelList);
+  }
+
+  // Done!
+  return eResult;
+}
+
+orxSTATUS ScrollBase::CompileMap(const orxSTRING _zSourceName, const orxSTRING _zDestinationName)
+{
+  const orxSTRING azMapKeyList[] = {szConfigDifferential, szConfigLayerNumber, szConfigCameraPosition, szConfigCameraZoom, szConfigScrollObjectNumber};
+  orxBOOL         abMapKeyList[orxARRAY_GET_ITEM_COUNT(azMapKeyList)];
+  orxHASHTABLE   *pstSectionTable = orxNULL;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  // Pushes map section
+  orxConfig_PushSection(szConfigSectionMap);
+
+  // Invalid?
+  if(!_zSourceName || (*_zSourceName == orxCHAR_NULL) || !_zDestinationName || (*_zDestinationName == orxCHAR_NULL))
+  {
+    // Logs message
+    orxLOG("Couldn't compile map: missing source or destination.");
+  }
+  // Object sections already in config, from a loaded or saved text map, would get overwritten?
+  else if(orxConfig_HasValue(szConfigScrollObjectNumber))
+  {
+    // Logs message
+    orxLOG("Couldn't compile map <%s>: a text map is currently loaded.", _zSourceName);
+  }
+  else
+  {
+    orxU32 u32SectionCount, i;
+
+    // Stores current map keys & sections, to clear the ones added by the source map afterwards
+    for(i = 0; i < orxARRAY_GET_ITEM_COUNT(azMapKeyList); i++)
+    {
+      abMapKeyList[i] = orxConfig_HasValue(azMapKeyList[i]);
+    }
+    u32SectionCount = orxConfig_GetSectionCount();
+    pstSectionTable = orxHashTable_Create(orxMAX(u32SectionCount, 1), orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+    for(i = 0; i < u32SectionCount; i++)
+    {
+      orxHashTable_Add(pstSectionTable, orxString_GetID(orxConfig_GetSection(i)), (void *)orxTRUE);
+    }
+  }
+
+  // Pops config section
+  orxConfig_PopSection();
+
+  // Can load source map?
+  if(pstSectionTable && orxConfig_Load(_zSourceName))
+  {
+    orxCHAR           acBuffer[32];
+    BinaryMapHeader   stHeader;
+    BinaryMapRecord  *astRecordList;
+    const orxSTRING  *azModelList;
+    orxU32            u32Count, u32Number, i;
+
+    // Inits header
+    orxMemory_Zero(&stHeader, sizeof(BinaryMapHeader));
+    stHeader.u32Tag = su32BinaryMapTag;
+
+    // Selects map section
+    orxConfig_PushSection(szConfigSectionMap);
+
+    // Stores map properties
+    if(orxConfig_GetBool(szConfigDifferential))
+    {
+      stHeader.u32Flags |= BinaryMapFlagDifferential;
+    }
+    if(orxConfig_HasValue(szConfigLayerNumber))
+    {
+      stHeader.u32LayerNumber = orxConfig_GetU32(szConfigLayerNumber);
+      stHeader.u32Flags      |= BinaryMapFlagLayerNumber;
+    }
+    if(orxConfig_GetVector(szConfigCameraPosition, &stHeader.vCameraPosition))
+    {
+      stHeader.u32Flags      |= BinaryMapFlagCameraPosition;
+    }
+    if(orxConfig_HasValue(szConfigCameraZoom))
+    {
+      stHeader.fCameraZoom    = orxConfig_GetFloat(szConfigCameraZoom);
+      stHeader.u32Flags      |= BinaryMapFlagCameraZoom;
+    }
+
+    // Gets number of objects
+    u32Number = orxConfig_GetU32(szConfigScrollObjectNumber);
+
+    // Pops config section
+    orxConfig_PopSection();
+
+    // Allocates records & model names
+    astRecordList = (BinaryMapRecord *)orxMemory_Allocate(orxMAX(u32Number, 1) * sizeof(BinaryMapRecord), orxMEMORY_TYPE_TEMP);
+    azModelList   = (const orxSTRING *)orxMemory_Allocate(orxMAX(u32Number, 1) * sizeof(orxSTRING), orxMEMORY_TYPE_TEMP);
+    orxMemory_Zero(astRecordList, orxMAX(u32Number, 1) * sizeof(BinaryMapRecord));
+
+    // For all objects, using the same lookup as LoadMap()
+    for(u32Count = 0, i = 0, orxString_NPrint(acBuffer, sizeof(acBuffer), szConfigScrollObjectFormat, i);
+        u32Count < u32Number;
+        i++, orxString_NPrint(acBuffer, sizeof(acBuffer), szConfigScrollObjectFormat, i))
+    {
+      // Has section?
+      if(orxConfig_HasSection(acBuffer))
+      {
+        BinaryMapRecord *pstRecord;
+
+        // Gets its record
+        pstRecord = &astRecordList[u32Count];
+
+        // Selects its section
+        orxConfig_PushSection(acBuffer);
+
+        // Stores all its properties
+        pstRecord->u32ID      = i;
+        azModelList[u32Count] = orxConfig_GetString(szConfigScrollObjectName);
+        if(orxConfig_GetVector(szConfigScrollObjectPosition, &pstRecord->vPosition))
+        {
+          pstRecord->u32Flags |= BinaryMapFlagPosition;
+        }
+        if(orxConfig_GetVector(szConfigScrollObjectScale, &pstRecord->vScale))
+        {
+          pstRecord->u32Flags |= BinaryMapFlagScale;
+        }
+        pstRecord->fRotation = orxConfig_GetFloat(szConfigScrollObjectRotation);
+        if(orxConfig_HasValue(szConfigScrollObjectAlpha))
+        {
+          pstRecord->stColor.fAlpha = orxConfig_GetFloat(szConfigScrollObjectAlpha);
+          pstRecord->u32Flags      |= BinaryMapFlagColor;
+        }
+        else
+        {
+          pstRecord->stColor.fAlpha = orxFLOAT_1;
+        }
+        if(orxConfig_GetVector(szConfigScrollObjectColor, &pstRecord->stColor.vRGB))
+        {
+          pstRecord->u32Flags      |= BinaryMapFlagColor;
+        }
+        else
+        {
+          orxVector_Copy(&pstRecord->stColor.vRGB, &orxVECTOR_WHITE);
+        }
+        if(orxConfig_GetBool(szConfigScrollObjectSmoothing))
+        {
+          pstRecord->u32Flags |= BinaryMapFlagSmoothing;
+        }
+        if(orxConfig_GetBool(szConfigScrollObjectTiling))
+        {
+          pstRecord->u32Flags |= BinaryMapFlagTiling;
+        }
+
+        // Pops config section
+        orxConfig_PopSection();
+
+        // Updates count
+        u32Count++;
+      }
+    }
+
+    // Updates header
+    stHeader.u32NextObjectID  = i;
+    stHeader.u32RecordNumber  = u32Count;
+
+    // Writes map
+    eResult = WriteBinaryMap(_zDestinationName, stHeader, astRecordList, azModelList);
+
+    // Frees records & model names
+    orxMemory_Free(astRecordList);
+    orxMemory_Free((void *)azModelList);
+
+    // Logs message
+    orxLOG("%s map <%s> to <%s>: %u objects.", (eResult != orxSTATUS_FAILURE) ? "Compiled" : "Couldn't compile", _zSourceName, _zDestinationName, u32Count);
+  }
+
+  // Had sections?
+  if(pstSectionTable)
+  {
+    orxS32 s32Index;
+    orxU32 i;
+
+    // Clears the ones added by the source map, backward as clearing shifts the following ones
+    for(s32Index = (orxS32)orxConfig_GetSectionCount() - 1; s32Index >= 0; s32Index--)
+    {
+      const orxSTRING zSection;
+
+      // Added by the source map?
+      zSection = orxConfig_GetSection((orxU32)s32Index);
+      if(orxHashTable_Get(pstSectionTable, orxString_GetID(zSection)) == orxNULL)
+      {
+        // Clears it
+        orxConfig_ClearSection(zSection);
+      }
+    }
+
+    // Deletes section table
+    orxHashTable_Delete(pstSectionTable);
+
+    // Pushes map section
+    orxConfig_PushSection(szConfigSectionMap);
+
+    // Clears the map keys added by the source map
+    for(i = 0; i < orxARRAY_GET_ITEM_COUNT(azMapKeyList); i++)
+    {
+      // Wasn't there before?
+      if(!abMapKeyList[i])
+      {
+        orxConfig_ClearValue(azMapKeyList[i]);
+      }
+    }
+
+    // Pops config section
+    orxConfig_PopSection();
+  }
+
+  // Done!
+  return eResult;
+}
+
+orxHANDLE ScrollBase::OpenBinaryMap(const orxSTRING _zMapName, BinaryMapHeader &_rstHeader) const
+{
+  const orxSTRING zLocation;
+  orxHANDLE       hResult = orxHANDLE_UNDEFINED;
+
+  // Locates map
+  zLocation = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, _zMapName);
+
+  // Success?
+  if(zLocation)
+  {
+    // Opens it
+    hResult = orxResource_Open(zLocation, orxFALSE);
+
+    // Success?
+    if(hResult != orxHANDLE_UNDEFINED)
+    {
+      // Not a binary map?
+      if((orxResource_Read(hResult, sizeof(BinaryMapHeader), &_rstHeader, orxNULL, orxNULL) != (orxS64)sizeof(BinaryMapHeader))
+      || (_rstHeader.u32Tag != su32BinaryMapTag))
+      {
+        // Closes it
+        orxResource_Close(hResult);
+
+        // Updates result
+        hResult = orxHANDLE_UNDEFINED;
+      }
+    }
+  }
+
+  // Done!
+  return hResult;
+}
+
+orxSTATUS ScrollBase::LoadBinaryMap(orxHANDLE _hResource, const BinaryMapHeader &_rstHeader)
+{
+  orxU8    *pu8Buffer = orxNULL;
+  orxS64    s64Size, s64FileSize, s64Offset;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Gets size of string table & records, not trusting the header
+  s64Size     = (orxS64)_rstHeader.u32StringTableSize + (orxS64)_rstHeader.u32RecordNumber * (orxS64)sizeof(BinaryMapRecord);
+  s64FileSize = orxResource_GetSize(_hResource);
+  s64Offset   = orxResource_Tell(_hResource);
+
+  // Fits in what's left of the file & in a single allocation?
+  if((s64Size <= s64FileSize - s64Offset)
+  && (s64Size <= (orxS64)orxU32_UNDEFINED))
+  {
+    // Allocates buffer
+    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)orxMAX(s64Size, 1), orxMEMORY_TYPE_TEMP);
+  }
+
+  // Reads everything at once, string table is null-terminated and keeps the records aligned?
+  if((pu8Buffer != orxNULL)
+  && (orxResource_Read(_hResource, s64Size, pu8Buffer, orxNULL, orxNULL) == s64Size)
+  && ((_rstHeader.u32StringTableSize == 0) || (pu8Buffer[_rstHeader.u32StringTableSize - 1] == orxCHAR_NULL))
+  && ((_rstHeader.u32StringTableSize % alignof(BinaryMapRecord)) == 0))
+  {
+    orxCHAR                 acBuffer[32];
+    const orxCHAR          *acStringTable;
+    const BinaryMapRecord  *astRecordList;
+    orxU32                  i;
+
+    // Gets string table & records
+    acStringTable = (const orxCHAR *)pu8Buffer;
+    astRecordList = (const BinaryMapRecord *)(pu8Buffer + _rstHeader.u32StringTableSize);
+
+    // Updates differential mode
+    mbDifferentialMode = orxFLAG_TEST(_rstHeader.u32Flags, BinaryMapFlagDifferential) ? orxTRUE : orxFALSE;
+
+    // For all records
+    for(i = 0; i < _rstHeader.u32RecordNumber; i++)
+    {
+      ScrollObject           *poObject = orxNULL;
+      const BinaryMapRecord  *pstRecord;
+
+      // Gets it
+      pstRecord = &astRecordList[i];
+
+      // Gets its name
+      orxString_NPrint(acBuffer, sizeof(acBuffer), szConfigScrollObjectFormat, pstRecord->u32ID);
+
+      // Valid model?
+      if(pstRecord->u32ModelOffset < _rstHeader.u32StringTableSize)
+      {
+        // Creates it
+        poObject = CreateObject(acStringTable + pstRecord->u32ModelOffset, ScrollObject::FlagSave, acBuffer);
+      }
+
+      // Valid?
+      if(poObject)
+      {
+        orxOBJECT *pstOrxObject;
+
+        // Gets internal object
+        pstOrxObject = poObject->GetOrxObject();
+
+        // Updates it
+        if(orxFLAG_TEST(pstRecord->u32Flags, BinaryMapFlagPosition))
+        {
+          orxObject_SetPosition(pstOrxObject, &pstRecord->vPosition);
+        }
+        if(orxFLAG_TEST(pstRecord->u32Flags, BinaryMapFlagScale))
+        {
+          orxObject_SetScale(pstOrxObject, &pstRecord->vScale);
+        }
+        orxObject_SetRotation(pstOrxObject, pstRecord->fRotation);
+
+        // Updates its differential mode
+        poObject->SetDifferentialMode(mbDifferentialMode);
+
+        // Has color?
+        if(orxFLAG_TEST(pstRecord->u32Flags, BinaryMapFlagColor))
+        {
+          // Applies it, also storing it in config for later saves
+          SetObjectConfigColor(poObject, pstRecord->stColor);
+        }
+
+        // Gets its smoothing
+        if(orxFLAG_TEST(pstRecord->u32Flags, BinaryMapFlagSmoothing))
+        {
+          // Applies it to object
+          orxObject_SetSmoothing(pstOrxObject, orxDISPLAY_SMOOTHING_ON);
+          poObject->SetFlags(ScrollObject::FlagSmoothed);
+        }
+        else
+        {
+          // Resets its smoothing
+          orxObject_SetSmoothing(pstOrxObject, orxDISPLAY_SMOOTHING_OFF);
+        }
+
+        // Gets its tiling
+        if(orxFLAG_TEST(pstRecord->u32Flags, BinaryMapFlagTiling))
+        {
+          // Applies it to object
+          orxObject_SetRepeat(pstOrxObject, orxMath_Abs(pstRecord->vScale.fX), orxMath_Abs(pstRecord->vScale.fY));
+          poObject->SetFlags(ScrollObject::FlagTiled);
+        }
+        else
+        {
+          // Resets its tiling
+          orxObject_SetRepeat(pstOrxObject, orxFLOAT_1, orxFLOAT_1);
+        }
+      }
+      else
+      {
+        // Logs message
+        orxLOG("Couldn't load object [%s]: invalid model <%s>.", acBuffer, (pstRecord->u32ModelOffset < _rstHeader.u32StringTableSize) ? acStringTable + pstRecord->u32ModelOffset : orxSTRING_EMPTY);
+      }
+    }
+
+    // Updates next object ID
+    mu32NextObjectID = orxMAX(mu32NextObjectID, _rstHeader.u32NextObjectID);
+
+    // Has layer number?
+    if(orxFLAG_TEST(_rstHeader.u32Flags, BinaryMapFlagLayerNumber))
+    {
+      // Stores it
+      SetLayerNumber(_rstHeader.u32LayerNumber);
+    }
+
+    // Has camera position?
+    if(orxFLAG_TEST(_rstHeader.u32Flags, BinaryMapFlagCameraPosition))
+    {
+      // Updates camera position
+      orxCamera_SetPosition(mpstMainCamera, &_rstHeader.vCameraPosition);
+    }
+
+    // Has camera zoom?
+    if(orxFLAG_TEST(_rstHeader.u32Flags, BinaryMapFlagCameraZoom))
+    {
+      // Updates camera zoom
+      orxCamera_SetZoom(mpstMainCamera, _rstHeader.fCameraZoom);
+    }
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxLOG("Couldn't load binary map <%s>: truncated or corrupted file.", mzMapName);
+  }
+
+  // Has buffer?
+  if(pu8Buffer != orxNULL)
+  {
+    // Frees it
+    orxMemory_Free(pu8Buffer);
+  }
+
+  // Done!
+  return eResult;
+}
+
+orxSTATUS ScrollBase::WriteBinaryMap(const orxSTRING _zFileName, BinaryMapHeader &_rstHeader, BinaryMapRecord *_astRecordList, const orxSTRING *_azModelList) const
+{
+  orxHASHTABLE *pstOffsetTable;
+  orxCHAR      *acStringTable;
+  orxFILE      *pstFile;
+  orxU32        u32Size, i;
+  orxSTATUS     eResult = orxSTATUS_FAILURE;
+
+  // Gets string table's maximum size, with its padding
+  for(i = 0, u32Size = 0; i < _rstHeader.u32RecordNumber; i++)
+  {
+    u32Size += orxString_GetLength(_azModelList[i]) + 1;
+  }
+  u32Size = orxALIGN(u32Size, (orxU32)alignof(BinaryMapRecord));
+
+  // Allocates string table & offset lookup
+  acStringTable   = (orxCHAR *)orxMemory_Allocate(orxMAX(u32Size, 1), orxMEMORY_TYPE_TEMP);
+  orxMemory_Zero(acStringTable, orxMAX(u32Size, 1));
+  pstOffsetTable  = orxHashTable_Create(orxMAX(_rstHeader.u32RecordNumber, 1), orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
+  // For all records
+  for(i = 0, u32Size = 0; i < _rstHeader.u32RecordNumber; i++)
+  {
+    orxSTRINGID stID;
+    orxUPTR     uOffset;
+
+    // Gets model's ID
+    stID = orxString_GetID(_azModelList[i]);
+
+    // Not already stored?
+    if((uOffset = (orxUPTR)orxHashTable_Get(pstOffsetTable, stID)) == 0)
+    {
+      orxU32 u32Length;
+
+      // Copies it
+      u32Length = orxString_GetLength(_azModelList[i]);
+      orxMemory_Copy(acStringTable + u32Size, _azModelList[i], u32Length + 1);
+
+      // Stores its offset, shifted so that 0 means not found
+      uOffset = (orxUPTR)u32Size + 1;
+      orxHashTable_Add(pstOffsetTable, stID, (void *)uOffset);
+
+      // Updates size
+      u32Size += u32Length + 1;
+    }
+
+    // Updates record
+    _astRecordList[i].u32ModelOffset = (orxU32)(uOffset - 1);
+  }
+
+  // Pads it so that the records that follow it are aligned
+  u32Size = orxALIGN(u32Size, (orxU32)alignof(BinaryMapRecord));
+
+  // Updates header
+  _rstHeader.u32StringTableSize = u32Size;
+
+  // Opens file
+  pstFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  // Success?
+  if(pstFile)
+  {
+    // Writes header, string table & records
+    if((orxFile_Write(&_rstHeader, sizeof(BinaryMapHeader), 1, pstFile) == 1)
+    && ((u32Size == 0) || (orxFile_Write(acStringTable, u32Size, 1, pstFile) == 1))
+    && ((_rstHeader.u32RecordNumber == 0) || (orxFile_Write(_astRecordList, sizeof(BinaryMapRecord), _rstHeader.u32RecordNumber, pstFile) == _rstHeader.u32RecordNumber)))
+    {
+      // Updates result
+      eResult = orxSTATUS_SUCCESS;
+    }
+
+    // Closes file
+    orxFile_Close(pstFile);
+  }
+
+  // Frees string table & offset lookup
+  orxHashTable_Delete(pstOffsetTable);
+  orxMemory_Free(acStringTable);
+
+  // Done!
+  return eResult;
+}
+
 orxSTATUS ScrollBase::ResetMap()
 {
   orxVECTOR vPos;
@@ -1455,38 +2211,163 @@ orxSTATUS ScrollBase::PauseGame(orxBOOL _bPause)
       }
     }
 
-    // Unlocks object list
-    mbObjectListLocked = orxFALSE;
+    // Unlocks object list
+    mbObjectListLocked = orxFALSE;
+
+    // Updates status
+    mbIsPaused = _bPause;
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+
+    // Calls pause game callback
+    OnPauseGame(_bPause);
+  }
+  else
+  {
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+orxBOOL ScrollBase::IsGamePaused() const
+{
+  // Done!
+  return mbIsPaused;
+}
+
+orxU32 ScrollBase::GetFrameCount() const
+{
+  // Done!
+  return mu32FrameCount;
+}
+
+void *ScrollBase::AllocateFrameMemory(orxU32 _u32Size, orxU32 _u32Alignment)
+{
+  orxU32  u32Offset;
+  void   *pResult;
+
+  // Checks
+  orxASSERT(orxMath_IsPowerOfTwo(_u32Alignment) && (_u32Alignment <= su32FrameMemoryHeaderSize));
+
+  // Gets aligned offset
+  u32Offset = orxALIGN(mu32FrameMemoryCursor, _u32Alignment);
+
+  // Fits?
+  if(u32Offset + _u32Size <= mstFrameMemoryStats.u32Capacity)
+  {
+    // Updates cursor
+    mu32FrameMemoryCursor = u32Offset + _u32Size;
+
+    // Updates result
+    pResult = mpu8FrameMemory + u32Offset;
+  }
+  else
+  {
+    orxU8 *pu8Block;
+
+    // Allocates its own block, freed along with the frame
+    pu8Block = (orxU8 *)orxMemory_Allocate(su32FrameMemoryHeaderSize + _u32Size, orxMEMORY_TYPE_MAIN);
+    orxASSERT(pu8Block);
+
+    // Links it
+    *(void **)pu8Block    = mpFrameMemoryOverflow;
+    mpFrameMemoryOverflow = pu8Block;
+
+    // Updates stats
+    mu32FrameMemoryOverflowSize += _u32Size;
+    mstFrameMemoryStats.u32OverflowCount++;
+
+    // Updates result
+    pResult = pu8Block + su32FrameMemoryHeaderSize;
+  }
+
+  // Done!
+  return pResult;
+}
+
+const ScrollBase::FrameMemoryStats &ScrollBase::GetFrameMemoryStats() const
+{
+  // Done!
+  return mstFrameMemoryStats;
+}
+
+void ScrollBase::ResetFrameMemory()
+{
+  orxU32 u32Size;
+
+  // Gets frame size
+  u32Size = mu32FrameMemoryCursor + mu32FrameMemoryOverflowSize;
+
+  // Updates stats
+  mstFrameMemoryStats.u32Size     = u32Size;
+  mstFrameMemoryStats.u32PeakSize = orxMAX(mstFrameMemoryStats.u32PeakSize, u32Size);
+
+  // Should poison?
+  if(mbFrameMemoryPoison)
+  {
+    // Poisons used memory, to catch pointers kept past their frame
+    orxMemory_Set(mpu8FrameMemory, su8FrameMemoryPoison, mu32FrameMemoryCursor);
+  }
 
-    // Updates status
-    mbIsPaused = _bPause;
+  // For all overflow blocks
+  while(mpFrameMemoryOverflow)
+  {
+    void *pBlock;
 
-    // Updates result
-    eResult = orxSTATUS_SUCCESS;
+    // Unlinks it
+    pBlock                = mpFrameMemoryOverflow;
+    mpFrameMemoryOverflow = *(void **)pBlock;
 
-    // Calls pause game callback
-    OnPauseGame(_bPause);
+    // Deletes it
+    orxMemory_Free(pBlock);
   }
-  else
+
+  // Overflowed?
+  if(mu32FrameMemoryOverflowSize != 0)
   {
-    // Updates result
-    eResult = orxSTATUS_FAILURE;
+    // Grows memory to fit the whole frame next time, no content to preserve
+    orxMemory_Free(mpu8FrameMemory);
+    mstFrameMemoryStats.u32Capacity = orxMath_GetNextPowerOfTwo(u32Size);
+    mpu8FrameMemory                 = (orxU8 *)orxMemory_Allocate(mstFrameMemoryStats.u32Capacity, orxMEMORY_TYPE_MAIN);
+    orxASSERT(mpu8FrameMemory);
+
+#ifdef __SCROLL_DEBUG__
+    // Logs message
+    orxLOG("Frame memory overflowed by %u bytes, growing to %u bytes.", mu32FrameMemoryOverflowSize, mstFrameMemoryStats.u32Capacity);
+#endif // __SCROLL_DEBUG__
   }
 
+  // Clears frame
+  mu32FrameMemoryCursor       = 0;
+  mu32FrameMemoryOverflowSize = 0;
+}
+
+orxBOOL ScrollBase::IsFixedStep() const
+{
   // Done!
-  return eResult;
+  return (mfFixedStepDT > orxFLOAT_0) ? orxTRUE : orxFALSE;
 }
 
-orxBOOL ScrollBase::IsGamePaused() const
+orxFLOAT ScrollBase::GetFixedStepDT() const
 {
   // Done!
-  return mbIsPaused;
+  return mfFixedStepDT;
 }
 
-orxU32 ScrollBase::GetFrameCount() const
+orxFLOAT ScrollBase::GetFixedStepAlpha() const
 {
   // Done!
-  return mu32FrameCount;
+  return (mfFixedStepDT > orxFLOAT_0) ? mfFixedStepAccumulator / mfFixedStepDT : orxFLOAT_1;
+}
+
+orxU32 ScrollBase::GetFixedStepCount() const
+{
+  // Done!
+  return mu32FixedStepCount;
 }
 
 orxVIEWPORT *ScrollBase::GetMainViewport() const
@@ -1649,8 +2530,44 @@ orxSTATUS ScrollBase::BaseInit()
   // Gets core clock
   pstCoreClock = orxClock_Get(orxCLOCK_KZ_CORE);
 
+  // Pushes fixed step section
+  orxConfig_PushSection(szConfigSectionFixedStep);
+
+  // Has fixed step frequency?
+  if(orxConfig_GetFloat(szConfigFixedStepFrequency) > orxFLOAT_0)
+  {
+    // Stores step DT & catch-up limit
+    mfFixedStepDT         = orxFLOAT_1 / orxConfig_GetFloat(szConfigFixedStepFrequency);
+    mu32FixedStepMaxCount = orxConfig_HasValue(szConfigFixedStepMaxStepCount) ? orxMAX(orxConfig_GetU32(szConfigFixedStepMaxStepCount), 1) : 1;
+
+    // Caps core clock DT so that physics & game logic catch up with the same bound
+    orxClock_SetModifier(pstCoreClock, orxCLOCK_MODIFIER_MAXED, orxU2F(mu32FixedStepMaxCount) * mfFixedStepDT);
+  }
+
+  // Pops config section
+  orxConfig_PopSection();
+
+  // Pushes frame memory section
+  orxConfig_PushSection(szConfigSectionFrameMemory);
+
+  // Allocates frame memory
+  mstFrameMemoryStats.u32Capacity = orxConfig_HasValue(szConfigFrameMemorySize) ? orxConfig_GetU32(szConfigFrameMemorySize) : su32FrameMemoryDefaultSize;
+  mpu8FrameMemory                 = (orxU8 *)orxMemory_Allocate(mstFrameMemoryStats.u32Capacity, orxMEMORY_TYPE_MAIN);
+  orxASSERT(mpu8FrameMemory);
+
+  // Gets poison mode, on by default in debug
+#ifdef __orxDEBUG__
+  mbFrameMemoryPoison = orxConfig_HasValue(szConfigFrameMemoryPoison) ? orxConfig_GetBool(szConfigFrameMemoryPoison) : orxTRUE;
+#else // __orxDEBUG__
+  mbFrameMemoryPoison = orxConfig_GetBool(szConfigFrameMemoryPoison);
+#endif // __orxDEBUG__
+
+  // Pops config section
+  orxConfig_PopSection();
+
   // Registers update function
-  eResult = ((orxClock_Register(pstCoreClock, StaticUpdate, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_NORMAL) != orxSTATUS_FAILURE)
+  eResult = ((orxClock_Register(pstCoreClock, StaticResetFrameMemory, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_HIGHEST) != orxSTATUS_FAILURE)
+          && (orxClock_Register(pstCoreClock, StaticUpdate, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_NORMAL) != orxSTATUS_FAILURE)
           && (orxClock_Register(pstCoreClock, StaticCameraUpdate, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_LOWER) != orxSTATUS_FAILURE)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
 
   // Successful?
@@ -1663,7 +2580,8 @@ orxSTATUS ScrollBase::BaseInit()
             && (orxEvent_AddHandler(orxEVENT_TYPE_RENDER, StaticEventHandler) != orxSTATUS_FAILURE)
             && (orxEvent_AddHandler(orxEVENT_TYPE_SHADER, StaticEventHandler) != orxSTATUS_FAILURE)
             && (orxEvent_AddHandler(orxEVENT_TYPE_PHYSICS, StaticEventHandler) != orxSTATUS_FAILURE)
-            && (orxEvent_AddHandler(orxEVENT_TYPE_FX, StaticEventHandler) != orxSTATUS_FAILURE)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+            && (orxEvent_AddHandler(orxEVENT_TYPE_FX, StaticEventHandler) != orxSTATUS_FAILURE)
+            && (orxEvent_AddHandler(orxEVENT_TYPE_CONFIG, StaticEventHandler) != orxSTATUS_FAILURE)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
 
     // Successful?
     if(eResult != orxSTATUS_FAILURE)
@@ -1677,6 +2595,13 @@ orxSTATUS ScrollBase::BaseInit()
       orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_PHYSICS, orxNULL, orxEVENT_GET_FLAG(orxPHYSICS_EVENT_CONTACT_ADD) | orxEVENT_GET_FLAG(orxPHYSICS_EVENT_CONTACT_REMOVE), orxEVENT_KU32_MASK_ID_ALL);
       orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_FX, orxNULL, orxEVENT_GET_FLAG(orxFX_EVENT_START) | orxEVENT_GET_FLAG(orxFX_EVENT_STOP) | orxEVENT_GET_FLAG(orxFX_EVENT_LOOP), orxEVENT_KU32_MASK_ID_ALL);
 
+      // Registers commands
+      {
+        static const orxCOMMAND_VAR_DEF stCompileMapResult = {"Success", orxCOMMAND_VAR_TYPE_BOOL};
+        static const orxCOMMAND_VAR_DEF astCompileMapParams[] = {{"Source", orxCOMMAND_VAR_TYPE_STRING}, {"Destination", orxCOMMAND_VAR_TYPE_STRING}};
+        orxCommand_Register("Scroll.CompileMap", StaticCompileMapCommand, 2, 0, astCompileMapParams, &stCompileMapResult);
+      }
+
       // Clears object lists
       orxMemory_Zero(&mstObjectList, sizeof(orxLINKLIST));
       orxMemory_Zero(&mstObjectChronoList, sizeof(orxLINKLIST));
@@ -1754,6 +2679,9 @@ void ScrollBase::BaseExit()
     DeleteObject(poObject);
   }
 
+  // Unregisters commands
+  orxCommand_Unregister("Scroll.CompileMap");
+
   // Removes event handler
   orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, StaticEventHandler);
   orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, StaticEventHandler);
@@ -1761,17 +2689,40 @@ void ScrollBase::BaseExit()
   orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, StaticEventHandler);
   orxEvent_RemoveHandler(orxEVENT_TYPE_SHADER, StaticEventHandler);
   orxEvent_RemoveHandler(orxEVENT_TYPE_PHYSICS, StaticEventHandler);
+  orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, StaticEventHandler);
 
   // Deletes binder's table
   ScrollObjectBinderBase::DeleteTable();
+
+  // Clears frame memory
+  ResetFrameMemory();
+
+  // Deletes it
+  orxMemory_Free(mpu8FrameMemory);
+  mpu8FrameMemory                 = orxNULL;
+  mstFrameMemoryStats.u32Capacity = 0;
 }
 
-void ScrollBase::BaseUpdate(const orxCLOCK_INFO &_rstInfo)
+void ScrollBase::BaseUpdate(const orxCLOCK_INFO &_rstInfo, orxU32 _u32StepCount)
 {
+  // Profiles
+  orxPROFILER_PUSH_MARKER("ScrollBase_Update");
+
   // Not paused?
   if(!mbIsPaused)
   {
-    orxOBJECT *pstObject;
+    orxCLOCK_INFO stStepInfo;
+    orxOBJECT    *pstObject;
+
+    // Inits step info
+    orxMemory_Copy(&stStepInfo, &_rstInfo, sizeof(orxCLOCK_INFO));
+
+    // Fixed step?
+    if(IsFixedStep())
+    {
+      // Uses fixed DT
+      stStepInfo.fDT = mfFixedStepDT;
+    }
 
     // Locks object list
     mbObjectListLocked = orxTRUE;
@@ -1807,8 +2758,13 @@ void ScrollBase::BaseUpdate(const orxCLOCK_INFO &_rstInfo)
               // For all inputs
               for(const orxSTRING zInput = orxInput_GetNext(orxNULL); zInput; zInput = orxInput_GetNext(zInput))
               {
-                orxCHAR acBuffer[256], *pc = acBuffer;
-                orxBOOL bInstant = orxFALSE;
+                orxCHAR *acBuffer, *pc;
+                orxU32   u32Size;
+                orxBOOL  bInstant = orxFALSE;
+
+                // Gets buffer from frame memory: name + markers + null
+                u32Size   = orxString_GetLength(zInput) + 3;
+                acBuffer  = pc = AllocateFrameArray<orxCHAR>(u32Size);
 
                 // Has new status?
                 if(orxInput_HasNewStatus(zInput))
@@ -1828,7 +2784,7 @@ void ScrollBase::BaseUpdate(const orxCLOCK_INFO &_rstInfo)
                 }
 
                 // Adds input name
-                orxString_NPrint(pc, sizeof(acBuffer) - (orxU32)(pc - acBuffer), "%s", zInput);
+                orxString_NPrint(pc, u32Size - (orxU32)(pc - acBuffer), "%s", zInput);
                 pc = acBuffer;
 
                 // Fires trigger
@@ -1859,8 +2815,21 @@ void ScrollBase::BaseUpdate(const orxCLOCK_INFO &_rstInfo)
           }
           else
           {
-            // Updates object
-            poObject->Update(_rstInfo);
+            // For all steps
+            for(orxU32 i = 0; i < _u32StepCount; i++)
+            {
+              // Updates step time
+              stStepInfo.fTime = _rstInfo.fTime - (mfFixedStepAccumulator + orxU2F(_u32StepCount - 1 - i) * stStepInfo.fDT);
+
+              // Updates object
+              poObject->Update(stStepInfo);
+
+              // Was deleted during update?
+              if(orxObject_GetLifeTime(pstObject) == orxFLOAT_0)
+              {
+                break;
+              }
+            }
           }
 
           // Has input set?
@@ -1879,6 +2848,9 @@ void ScrollBase::BaseUpdate(const orxCLOCK_INFO &_rstInfo)
 
   // Calls child update
   Update(_rstInfo);
+
+  // Profiles
+  orxPROFILER_POP_MARKER();
 }
 
 void ScrollBase::BaseCameraUpdate(const orxCLOCK_INFO &_rstInfo)
@@ -2013,8 +2985,36 @@ void orxFASTCALL ScrollBase::StaticUpdate(const orxCLOCK_INFO *_pstInfo, void *_
   // Running?
   if(roGame.mbIsRunning)
   {
+    orxU32 u32StepCount = 1;
+
+    // Fixed step and not paused?
+    if(roGame.IsFixedStep() && !roGame.mbIsPaused)
+    {
+      // Accumulates time
+      roGame.mfFixedStepAccumulator += _pstInfo->fDT;
+
+      // Gets number of steps to run
+      u32StepCount = orxF2U(roGame.mfFixedStepAccumulator / roGame.mfFixedStepDT);
+
+      // Above catch-up limit?
+      if(u32StepCount > roGame.mu32FixedStepMaxCount)
+      {
+        // Drops extra time
+        u32StepCount                  = roGame.mu32FixedStepMaxCount;
+        roGame.mfFixedStepAccumulator = orxFLOAT_0;
+      }
+      else
+      {
+        // Consumes stepped time
+        roGame.mfFixedStepAccumulator -= orxU2F(u32StepCount) * roGame.mfFixedStepDT;
+      }
+    }
+
+    // Stores step count
+    roGame.mu32FixedStepCount = u32StepCount;
+
     // Calls base update
-    roGame.BaseUpdate(*_pstInfo);
+    roGame.BaseUpdate(*_pstInfo, u32StepCount);
   }
 }
 
@@ -2026,6 +3026,22 @@ void orxFASTCALL ScrollBase::StaticCameraUpdate(const orxCLOCK_INFO *_pstInfo, v
   roGame.BaseCameraUpdate(*_pstInfo);
 }
 
+void orxFASTCALL ScrollBase::StaticResetFrameMemory(const orxCLOCK_INFO *_pstInfo, void *_pstContext)
+{
+  ScrollBase &roGame = GetInstance();
+
+  // Starts a new frame
+  roGame.ResetFrameMemory();
+}
+
+void orxFASTCALL ScrollBase::StaticCompileMapCommand(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  ScrollBase &roGame = GetInstance();
+
+  // Compiles map
+  _pstResult->bValue = (roGame.CompileMap(_astArgList[0].zValue, _astArgList[1].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+}
+
 orxBOOL orxFASTCALL ScrollBase::StaticMapSaveFilter(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
 {
   ScrollBase &roGame = GetInstance();
@@ -2038,6 +3054,9 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
 
+  // Profiles
+  orxPROFILER_PUSH_MARKER("ScrollBase_EventHandler");
+
   // Depending on event type
   switch(_pstEvent->eType)
   {
@@ -2076,17 +3095,16 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
         {
           ScrollObjectBinderBase *poBinder;
 
-          // Gets binder
-          poBinder = ScrollObjectBinderBase::GetBinder(orxObject_GetName(pstObject), roGame.mzCurrentCreateObject ? orxTRUE : orxFALSE);
+          // Gets binder, unless the model opted out of binding
+          poBinder = ScrollObjectBinderBase::GetBinder(orxObject_GetName(pstObject), roGame.mzCurrentCreateObject ? orxTRUE : orxFALSE, orxTRUE);
 
           // Found?
           if(poBinder)
           {
-            orxCHAR       zInstanceName[32];
             ScrollObject *poObject;
 
-            // Uses it
-            poObject = poBinder->CreateObject(pstObject, roGame.GetNewObjectName(zInstanceName, orxTRUE), ScrollObject::FlagRunTime);
+            // Uses it, deferring its runtime name
+            poObject = poBinder->CreateObject(pstObject, orxNULL, ScrollObject::FlagRunTime);
 
             // Valid?
             if(poObject)
@@ -2138,6 +3156,18 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
       break;
     }
 
+    // Config event
+    case orxEVENT_TYPE_CONFIG:
+    {
+      // Reloaded?
+      if(_pstEvent->eID == orxCONFIG_EVENT_RELOAD_STOP)
+      {
+        // Clears cached model info
+        ScrollObjectBinderBase::ClearModelTable();
+      }
+      break;
+    }
+
     // Physics event
     case orxEVENT_TYPE_PHYSICS:
     {
@@ -2373,6 +3403,9 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
     }
   }
 
+  // Profiles
+  orxPROFILER_POP_MARKER();
+
   // Done!
   return eResult;
 }
@@ -2396,9 +3429,24 @@ const orxU32            ScrollObjectBinderBase::su32TableSize     = 64;
 
 //! Static variables
 orxHASHTABLE *          ScrollObjectBinderBase::spstTable         = orxNULL;
+orxHASHTABLE *          ScrollObjectBinderBase::spstModelTable    = orxNULL;
+orxBANK *               ScrollObjectBinderBase::spstModelBank     = orxNULL;
 
 
 //! Code
+const orxSTRING ScrollObject::GetName() const
+{
+  // Deferred runtime name?
+  if((macName[0] == orxCHAR_NULL) && (mu32RuntimeID != orxU32_UNDEFINED))
+  {
+    // Creates it
+    orxString_NPrint(macName, sizeof(macName), ScrollBase::szConfigScrollObjectRuntimeFormat, mu32RuntimeID);
+  }
+
+  // Done!
+  return macName;
+}
+
 orxHASHTABLE *ScrollObjectBinderBase::GetTable()
 {
   if(!spstTable)
@@ -2439,6 +3487,250 @@ void ScrollObjectBinderBase::DeleteTable()
   // Deletes binder table
   orxHashTable_Delete(spstTable);
   spstTable = orxNULL;
+
+  // Has model table?
+  if(spstModelTable)
+  {
+    // Deletes it
+    orxHashTable_Delete(spstModelTable);
+    spstModelTable = orxNULL;
+    orxBank_Delete(spstModelBank);
+    spstModelBank = orxNULL;
+  }
+}
+
+void ScrollObjectBinderBase::VisitBinders(void (*_pfnVisit)(ScrollObjectBinderBase *_poBinder, void *_pContext), void *_pContext)
+{
+  orxHASHTABLE           *pstVisitTable;
+  ScrollObjectBinderBase *poBinder;
+
+  // Creates table of visited binders, as they can be registered under several names
+  pstVisitTable = orxHashTable_Create(su32TableSize, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
+  // Has default binder?
+  if((poBinder = ScrollObjectBinder<ScrollObject>::GetInstance()) != orxNULL)
+  {
+    // Adds it to visit table
+    orxHashTable_Add(pstVisitTable, (orxU64)poBinder, (void *)poBinder);
+
+    // Visits it
+    _pfnVisit(poBinder, _pContext);
+  }
+
+  // Has registered binders?
+  if(spstTable)
+  {
+    // For all registered binders
+    for(orxHANDLE h = orxHashTable_GetNext(spstTable, orxNULL, orxNULL, (void **)&poBinder);
+        h != orxHANDLE_UNDEFINED;
+        h = orxHashTable_GetNext(spstTable, h, orxNULL, (void **)&poBinder))
+    {
+      // Not already visited?
+      if(!orxHashTable_Get(pstVisitTable, (orxU64)poBinder))
+      {
+        // Adds it to visit table
+        orxHashTable_Add(pstVisitTable, (orxU64)poBinder, (void *)poBinder);
+
+        // Visits it
+        _pfnVisit(poBinder, _pContext);
+      }
+    }
+  }
+
+  // Deletes visit table
+  orxHashTable_Delete(pstVisitTable);
+}
+
+void ScrollObjectBinderBase::GetBankUsage(orxU32 &_ru32BinderCount, orxU64 &_ru64UsedSize, orxU64 &_ru64ReservedSize)
+{
+  struct BankUsage
+  {
+    orxU32 u32BinderCount;
+    orxU64 u64UsedSize;
+    orxU64 u64ReservedSize;
+  } stUsage = {};
+
+  // For all binders
+  VisitBinders([](ScrollObjectBinderBase *_poBinder, void *_pContext)
+  {
+    BankUsage *pstUsage = (BankUsage *)_pContext;
+
+    // Updates sizes, banks grow by whole segments and never shrink
+    pstUsage->u32BinderCount++;
+    pstUsage->u64UsedSize     += (orxU64)orxBank_GetCount(_poBinder->mpstBank) * (orxU64)_poBinder->mu32ElementSize;
+    pstUsage->u64ReservedSize += (orxU64)_poBinder->mu32Capacity * (orxU64)_poBinder->mu32ElementSize;
+  }, &stUsage);
+
+  // Stores results
+  _ru32BinderCount  = stUsage.u32BinderCount;
+  _ru64UsedSize     = stUsage.u64UsedSize;
+  _ru64ReservedSize = stUsage.u64ReservedSize;
+}
+
+void ScrollObjectBinderBase::LogBankUsage()
+{
+  // For all binders
+  VisitBinders([](ScrollObjectBinderBase *_poBinder, void *_pContext)
+  {
+    // Logs its bank usage
+    orxLOG("[%s] %u/%u objects (peak %u), segments of %u, %u growth(s), %u KB reserved.",
+           _poBinder->mzName,
+           orxBank_GetCount(_poBinder->mpstBank),
+           _poBinder->mu32Capacity,
+           _poBinder->mu32PeakCount,
+           _poBinder->mu32SegmentSize,
+           _poBinder->mu32GrowthCount,
+           (orxU32)(((orxU64)_poBinder->mu32Capacity * (orxU64)_poBinder->mu32ElementSize) / 1024));
+  }, orxNULL);
+}
+
+void ScrollObjectBinderBase::GetBankConfig(const orxSTRING _zName, orxS32 &_rs32SegmentSize, orxU32 &_ru32ReserveCount)
+{
+  // Clears reserve count
+  _ru32ReserveCount = 0;
+
+  // Valid name?
+  if(_zName && (*_zName != orxCHAR_NULL))
+  {
+    // Pushes its section
+    orxConfig_PushSection(_zName);
+
+    // Has segment size?
+    if(orxConfig_HasValue(ScrollBase::szConfigScrollObjectBankSegmentSize))
+    {
+      // Overrides it
+      _rs32SegmentSize = orxMAX(orxConfig_GetS32(ScrollBase::szConfigScrollObjectBankSegmentSize), 1);
+    }
+
+    // Gets reserve count
+    _ru32ReserveCount = orxConfig_GetU32(ScrollBase::szConfigScrollObjectBankReserve);
+
+    // Pops section
+    orxConfig_PopSection();
+  }
+}
+
+void ScrollObjectBinderBase::SetupBank(const orxSTRING _zName, orxU32 _u32ReserveCount)
+{
+  // First name?
+  if(mzName == orxSTRING_EMPTY)
+  {
+    // Stores it, for reports
+    mzName = orxString_Store(_zName ? _zName : orxSTRING_EMPTY);
+  }
+
+  // Reserves objects
+  Reserve(_u32ReserveCount);
+}
+
+void ScrollObjectBinderBase::Reserve(orxU32 _u32Count)
+{
+  orxU32 u32Count;
+
+  // Gets live object count
+  u32Count = orxBank_GetCount(mpstBank);
+
+  // Needs more room?
+  if(_u32Count > mu32Capacity)
+  {
+    void  **apCellList;
+    orxU32  i, u32Number;
+
+    // Gets number of cells to allocate
+    u32Number = _u32Count - u32Count;
+
+    // Allocates cell list
+    apCellList = (void **)orxMemory_Allocate(u32Number * sizeof(void *), orxMEMORY_TYPE_TEMP);
+    orxASSERT(apCellList);
+
+    // Allocates cells, creating all their segments now
+    for(i = 0; i < u32Number; i++)
+    {
+      apCellList[i] = orxBank_Allocate(mpstBank);
+    }
+
+    // Frees them in reverse order, so that they get reused in order
+    for(i = u32Number; i > 0; i--)
+    {
+      orxBank_Free(mpstBank, apCellList[i - 1]);
+    }
+
+    // Deletes cell list
+    orxMemory_Free(apCellList);
+
+    // Updates capacity
+    mu32Capacity = ((_u32Count + mu32SegmentSize - 1) / mu32SegmentSize) * mu32SegmentSize;
+  }
+}
+
+ScrollObjectBinderBase::ModelInfo *ScrollObjectBinderBase::GetModelInfo(const orxSTRING _zModelName)
+{
+  ModelInfo  *pstResult;
+  orxU64      u64Key;
+
+  // First call?
+  if(!spstModelTable)
+  {
+    // Creates model table & bank
+    spstModelTable  = orxHashTable_Create(su32TableSize, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    spstModelBank   = orxBank_Create(su32TableSize, sizeof(ModelInfo), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+  }
+
+  // Gets model's key
+  u64Key = orxString_Hash(_zModelName);
+
+  // Not already cached?
+  if(!(pstResult = (ModelInfo *)orxHashTable_Get(spstModelTable, u64Key)))
+  {
+    const orxSTRING zSection;
+
+    // Allocates it
+    pstResult = (ModelInfo *)orxBank_Allocate(spstModelBank);
+    orxMemory_Zero(pstResult, sizeof(ModelInfo));
+
+    // Gets associated binder, using config hierarchy
+    for(zSection = _zModelName, pstResult->poBinder = (ScrollObjectBinderBase *)orxHashTable_Get(GetTable(), orxString_Hash(zSection));
+        (!pstResult->poBinder) && ((zSection = orxConfig_GetParent(zSection)));
+        pstResult->poBinder = (ScrollObjectBinderBase *)orxHashTable_Get(GetTable(), orxString_Hash(zSection)));
+
+    // Pushes model section
+    orxConfig_PushSection(_zModelName);
+
+    // Should bind?
+    pstResult->bBind = ((!orxConfig_HasValue(ScrollBase::szConfigScrollObjectBind))
+                     || (orxConfig_GetBool(ScrollBase::szConfigScrollObjectBind))) ? orxTRUE : orxFALSE;
+
+    // Is pausable?
+    pstResult->bPausable = ((!orxConfig_HasValue(ScrollBase::szConfigScrollObjectPausable))
+                         || (orxConfig_GetBool(ScrollBase::szConfigScrollObjectPausable))) ? orxTRUE : orxFALSE;
+
+    // Has input set?
+    if(orxConfig_HasValue(ScrollBase::szConfigScrollObjectInput))
+    {
+      // Stores it
+      pstResult->zInputSet = orxString_Store(orxConfig_GetString(ScrollBase::szConfigScrollObjectInput));
+    }
+
+    // Pops section
+    orxConfig_PopSection();
+
+    // Stores it
+    orxHashTable_Add(spstModelTable, u64Key, pstResult);
+  }
+
+  // Done!
+  return pstResult;
+}
+
+void ScrollObjectBinderBase::ClearModelTable()
+{
+  // Has model table?
+  if(spstModelTable)
+  {
+    // Clears it
+    orxHashTable_Clear(spstModelTable);
+    orxBank_Clear(spstModelBank);
+  }
 }
 
 ScrollObjectBinderBase *ScrollObjectBinderBase::GetDefaultBinder()
@@ -2447,19 +3739,29 @@ ScrollObjectBinderBase *ScrollObjectBinderBase::GetDefaultBinder()
   return ScrollObjectBinder<ScrollObject>::GetInstance(512);
 }
 
-ScrollObjectBinderBase *ScrollObjectBinderBase::GetBinder(const orxSTRING _zName, orxBOOL _bAllowDefault)
+ScrollObjectBinderBase *ScrollObjectBinderBase::GetBinder(const orxSTRING _zName, orxBOOL _bAllowDefault, orxBOOL _bCheckBind)
 {
   ScrollObjectBinderBase *poResult = orxNULL;
 
   // Valid name?
-  if(_zName && (_zName != orxSTRING_EMPTY))
+  if(_zName && (_zName != orxSTRING_EMPTY) && (*_zName != orxCHAR_NULL))
   {
-    const orxSTRING zSection;
+    ModelInfo *pstModelInfo;
 
-    // Gets associated binder, using config hierarchy
-    for(zSection = _zName, poResult = (ScrollObjectBinderBase *)orxHashTable_Get(GetTable(), orxString_Hash(zSection));
-        (!poResult) && ((zSection = orxConfig_GetParent(zSection)));
-        poResult = (ScrollObjectBinderBase *)orxHashTable_Get(GetTable(), orxString_Hash(zSection)));
+    // Gets model info
+    pstModelInfo = GetModelInfo(_zName);
+
+    // Opted out of binding?
+    if(_bCheckBind && !pstModelInfo->bBind)
+    {
+      // Prevents default binder
+      _bAllowDefault = orxFALSE;
+    }
+    else
+    {
+      // Gets associated binder
+      poResult = pstModelInfo->poBinder;
+    }
   }
 
   // Not found and default allowed?
@@ -2478,6 +3780,16 @@ ScrollObjectBinderBase::ScrollObjectBinderBase(orxS32 _s32SegmentSize, orxU32 _u
   // Creates bank
   mpstBank = orxBank_Create((orxU32)_s32SegmentSize, _u32ElementSize, orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+  // Stores sizes
+  mu32SegmentSize = (orxU32)_s32SegmentSize;
+  mu32ElementSize = _u32ElementSize;
+
+  // Inits stats, the first segment is created along with the bank
+  mzName          = orxSTRING_EMPTY;
+  mu32Capacity    = mu32SegmentSize;
+  mu32PeakCount   = 0;
+  mu32GrowthCount = 0;
+
   // Clears variables
   mpoFirstObject = mpoLastObject = orxNULL;
 }
@@ -2517,11 +3829,15 @@ ScrollObject *ScrollObjectBinderBase::CreateObject(orxOBJECT *_pstOrxObject, con
 {
   ScrollObject *poResult;
 
+  // Profiles
+  orxPROFILER_PUSH_MARKER("ScrollObject_Create");
+
   // Is object valid?
   if(_pstOrxObject)
   {
     ScrollObject::Flag  xFlags;
     orxFLOAT            fRepeatX, fRepeatY;
+    ModelInfo          *pstModelInfo;
 
     // Gets game instance
     ScrollBase &roGame = ScrollBase::GetInstance();
@@ -2533,6 +3849,26 @@ ScrollObject *ScrollObjectBinderBase::CreateObject(orxOBJECT *_pstOrxObject, con
     // Creates scroll object
     poResult = ConstructObject(mpstBank);
 
+    // New peak?
+    if(orxBank_GetCount(mpstBank) > mu32PeakCount)
+    {
+      // Updates it
+      mu32PeakCount = orxBank_GetCount(mpstBank);
+
+      // Bank grew?
+      if(mu32PeakCount > mu32Capacity)
+      {
+        // Updates stats
+        mu32Capacity += mu32SegmentSize;
+        mu32GrowthCount++;
+
+#ifdef __SCROLL_DEBUG__
+        // Logs message
+        orxLOG("[%s] Bank grew to %u objects while creating <%s>, consider reserving more with %s.%s.", mzName, mu32Capacity, orxObject_GetName(_pstOrxObject), mzName, ScrollBase::szConfigScrollObjectBankReserve);
+#endif // __SCROLL_DEBUG__
+      }
+    }
+
     // Savable or runtime object?
     if(_xFlags & (ScrollObject::FlagSave | ScrollObject::FlagRunTime))
     {
@@ -2564,8 +3900,17 @@ ScrollObject *ScrollObjectBinderBase::CreateObject(orxOBJECT *_pstOrxObject, con
     // Sets object as user data
     orxObject_SetUserData(_pstOrxObject, poResult);
 
-    // Stores its name
-    orxString_NPrint(poResult->macName, sizeof(poResult->macName), "%s", _zInstanceName);
+    // Has name?
+    if(_zInstanceName)
+    {
+      // Stores it
+      orxString_NPrint(poResult->macName, sizeof(poResult->macName), "%s", _zInstanceName);
+    }
+    else
+    {
+      // Stores runtime ID, its name will only be created if requested
+      poResult->mu32RuntimeID = roGame.mu32RuntimeObjectID++;
+    }
 
     // Inits flags
     xFlags = _xFlags;
@@ -2605,12 +3950,11 @@ ScrollObject *ScrollObjectBinderBase::CreateObject(orxOBJECT *_pstOrxObject, con
       orxConfig_PopSection();
     }
 
-    // Pushes its section
-    poResult->PushConfigSection();
+    // Gets model info
+    pstModelInfo = GetModelInfo(orxObject_GetName(_pstOrxObject));
 
     // Is pausable?
-    if((!orxConfig_HasValue(ScrollBase::szConfigScrollObjectPausable))
-    || (orxConfig_GetBool(ScrollBase::szConfigScrollObjectPausable)))
+    if(pstModelInfo->bPausable)
     {
       // Updates flags
       xFlags |= ScrollObject::FlagPausable;
@@ -2620,32 +3964,47 @@ ScrollObject *ScrollObjectBinderBase::CreateObject(orxOBJECT *_pstOrxObject, con
     poResult->SetFlags(xFlags, ScrollObject::MaskAll);
 
     // Has input set?
-    if(orxConfig_HasValue(ScrollBase::szConfigScrollObjectInput))
+    if(pstModelInfo->zInputSet)
     {
-      // Stores it
-      poResult->mzInputSet = orxConfig_GetString(ScrollBase::szConfigScrollObjectInput);
-
-      // Enables it & pushes it
-      if((orxInput_EnableSet(poResult->mzInputSet, orxTRUE) != orxSTATUS_FAILURE)
-      && (orxInput_PushSet(poResult->mzInputSet) != orxSTATUS_FAILURE))
+      // First use?
+      if(!pstModelInfo->bInputReady)
       {
-        // No defined input?
-        if(!orxInput_GetNext(orxNULL))
+        // Enables it & pushes it
+        if((orxInput_EnableSet(pstModelInfo->zInputSet, orxTRUE) != orxSTATUS_FAILURE)
+        && (orxInput_PushSet(pstModelInfo->zInputSet) != orxSTATUS_FAILURE))
+        {
+          // No defined input?
+          if(!orxInput_GetNext(orxNULL))
+          {
+            // Updates its type
+            orxInput_SetTypeFlags(orxINPUT_KU32_FLAG_TYPE_NONE, orxINPUT_KU32_MASK_TYPE_ALL);
+          }
+
+          // Pops set
+          orxInput_PopSet();
+        }
+        else
         {
-          // Updates its type
-          orxInput_SetTypeFlags(orxINPUT_KU32_FLAG_TYPE_NONE, orxINPUT_KU32_MASK_TYPE_ALL);
+          // Clears set
+          pstModelInfo->zInputSet = orxNULL;
         }
 
-        // Pops set
-        orxInput_PopSet();
+        // Updates status
+        pstModelInfo->bInputReady = orxTRUE;
       }
       else
       {
-        // Clears set
-        poResult->mzInputSet = orxNULL;
+        // Enables it
+        orxInput_EnableSet(pstModelInfo->zInputSet, orxTRUE);
       }
+
+      // Stores it
+      poResult->mzInputSet = pstModelInfo->zInputSet;
     }
 
+    // Pushes its section
+    poResult->PushConfigSection();
+
     // Should use callback?
     if(poResult->TestFlags(ScrollObject::FlagSave | ScrollObject::FlagRunTime))
     {
@@ -2669,6 +4028,9 @@ ScrollObject *ScrollObjectBinderBase::CreateObject(orxOBJECT *_pstOrxObject, con
     poResult = orxNULL;
   }
 
+  // Profiles
+  orxPROFILER_POP_MARKER();
+
   // Done!
   return poResult;
 }
@@ -2720,8 +4082,8 @@ void ScrollObjectBinderBase::DeleteObject(ScrollObject *_poObject, const orxSTRI
     roGame.mbObjectListLocked = bObjectListBlockBackup;
   }
 
-  // Gets its name
-  zName = _poObject->GetName();
+  // Gets its name, without creating a deferred runtime one
+  zName = _poObject->macName;
 
   // Valid?
   if(zName && (zName[0] != orxCHAR_NULL))
@@ -56,7 +56,7 @@ public:
                 orxBOOL                 TestAllFlags(Flag _xTestFlags) const                      {return ((mxFlags & _xTestFlags) == _xTestFlags) ? orxTRUE : orxFALSE;}
                 Flag                    GetFlags(Flag _xMask = MaskAll) const                     {return (Flag)(mxFlags & _xMask);}
                 orxOBJECT *             GetOrxObject() const                                      {return mpstObject;}
-                const orxSTRING         GetName() const                                           {return macName;}
+                const orxSTRING         GetName() const;
                 const orxSTRING         GetModelName() const                                      {return mzModelName;}
                 orxU64                  GetGUID() const                                           {return orxStructure_GetGUID(mpstObject);}
 
@@ -173,7 +173,8 @@ private:
                 orxLINKLIST_NODE        mstChronoNode;
                 const orxSTRING         mzInputSet;
                 Flag                    mxFlags;
-                orxCHAR                 macName[16];
+                orxU32                  mu32RuntimeID;
+  mutable       orxCHAR                 macName[16];
 };
 
 
@@ -217,7 +218,7 @@ inline ScrollObject::Flag operator~(ScrollObject::Flag _x1)
 #ifdef __SCROLL_IMPL__
 
 //! Code
-ScrollObject::ScrollObject() : mpstObject(orxNULL), mzModelName(orxNULL), mzInputSet(orxNULL), mxFlags(FlagNone)
+ScrollObject::ScrollObject() : mpstObject(orxNULL), mzModelName(orxNULL), mzInputSet(orxNULL), mxFlags(FlagNone), mu32RuntimeID(orxU32_UNDEFINED)
 {
   // Clears nodes
   orxMemory_Zero(&mstNode, sizeof(orxLINKLIST_NODE));
@@ -716,7 +717,7 @@ void ScrollObject::SetLifeTime(orxFLOAT _fLifeTime)
 void ScrollObject::PushConfigSection(orxBOOL _bPushInstanceSection) const
 {
   // Pushes its model section
-  orxConfig_PushSection(_bPushInstanceSection ? macName : mzModelName);
+  orxConfig_PushSection(_bPushInstanceSection ? GetName() : mzModelName);
 }
 
 ScrollObject *ScrollObject::GetParent() const
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+#include "planet.h"
+
+namespace game
+{
+  /// Signed distance field font generator, run as part of the bundle step (`-b`)
+  ///
+  /// Glyphs of the `SdfFont.Font` bitmap font are turned into a small distance
+  /// field texture, `SdfFont.CharacterHeight` texels high. The generated config
+  /// defines the `SdfFont.Name` font and switches the text objects listed in
+  /// `SdfFont.ObjectList` to it, with the `SdfFont.Shader` shader and their
+  /// scale adjusted to keep their size. It's loaded at startup when present.
+  class SdfFont
+  {
+  public:
+    static SdfFont &Get();
+
+    /// @brief Load the generated config if present
+    /// @param build Generate a fresh font first, done when bundling
+    void Init(bool build);
+
+    /// @brief Generate the distance field texture and its config
+    /// @return `true` on success
+    bool Build() const;
+
+  private:
+    /// Glyph cell, in texels
+    struct Cell
+    {
+      orxU32 x{0};
+      orxU32 y{0};
+      orxU32 width{0};
+    };
+
+    /// @brief Place glyphs the way orx does for a font: left to right, wrapping at `textureWidth`
+    /// @return Total height used
+    static orxU32 Layout(const std::vector<orxU32> &widths, orxU32 height, const orxVECTOR &spacing, orxU32 textureWidth, std::vector<Cell> &cells);
+
+    bool WriteConfig(const std::vector<orxU32> &widths, orxFLOAT scale) const;
+  };
+}
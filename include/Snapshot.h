@@ -0,0 +1,31 @@
+#pragma once
+
+#include "planet.h"
+
+namespace game
+{
+  /// Compact binary checkpoints of the game scene, so benchmarks and
+  /// profiling sessions can jump straight to a given pile
+  ///
+  /// Snapshots hold the score, the dropper state, the gameplay random stream
+  /// and, for every planet in play, its model, position, rotation and
+  /// velocities. Files are read in one go and restored in a single pass.
+  class Snapshot
+  {
+  public:
+    static Snapshot &Get();
+
+    void Init();
+    void Exit();
+
+    /// @brief Save the current game scene
+    /// @param path File to write, `Snapshot.File` from config if NULL
+    /// @return `true` on success
+    bool Save(const orxSTRING path = orxNULL) const;
+
+    /// @brief Replace the current game scene's planets & state with a snapshot
+    /// @param path File to read, `Snapshot.File` from config if NULL
+    /// @return `true` on success
+    bool Load(const orxSTRING path = orxNULL) const;
+  };
+}
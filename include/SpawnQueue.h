@@ -0,0 +1,66 @@
+#pragma once
+
+#include <queue>
+#include <vector>
+
+#include "planet.h"
+
+namespace game
+{
+  /// Defers object creation & trigger events so bursts (eg. the game over
+  /// explosions) are spread over several frames instead of spiking one
+  ///
+  /// Each frame, queued entries are processed until `SpawnQueue.Budget` (ms)
+  /// is spent, at least one entry always goes through. Entries queued during
+  /// the same frame form a wave and are processed bottom-up, waves in order.
+  class SpawnQueue
+  {
+  public:
+    static SpawnQueue &Get();
+
+    void Init();
+    void Exit();
+
+    /// @brief Queue the creation of an object
+    /// @param model Object config section
+    /// @param position World position of the new object
+    void Create(const orxSTRING model, const orxVECTOR &position);
+
+    /// @brief Queue a trigger event on an object, skipped if it's gone by then
+    /// @param object Object GUID
+    /// @param event Trigger event, fired on the object only
+    void Fire(orxU64 object, const orxSTRING event);
+
+    /// @brief Process queued entries within the frame budget, called once per frame
+    void Update();
+
+    /// @brief Drop all queued entries
+    void Clear();
+
+    orxU32 GetCount() const;
+
+  private:
+    struct Entry
+    {
+      orxU32 wave{0};
+      orxU32 sequence{0};
+      const orxSTRING name{orxNULL};
+      orxVECTOR position{};
+      /// Trigger target, 0 for object creation
+      orxU64 object{0};
+    };
+
+    /// Earlier waves first, then lowest on screen (orx's Y points down), then queuing order
+    struct Later
+    {
+      bool operator()(const Entry &a, const Entry &b) const;
+    };
+
+    void Push(Entry &entry);
+    void Process(const Entry &entry) const;
+
+    std::priority_queue<Entry, std::vector<Entry>, Later> entries{};
+    orxU32 wave{0};
+    orxU32 sequence{0};
+  };
+}
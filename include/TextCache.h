@@ -0,0 +1,53 @@
+#pragma once
+
+#include <map>
+#include <utility>
+
+#include "planet.h"
+
+namespace game
+{
+  /// Laid out texts shared by (font, string), so showing a string again
+  /// doesn't create & lay out a new text
+  ///
+  /// Texts are ref-counted by orx: graphics using one keep it alive. Once the
+  /// cache holds `TextCache.Capacity` texts, those no graphic uses are dropped.
+  /// Hit/miss counts are kept in profiler builds.
+  class TextCache
+  {
+  public:
+    static TextCache &Get();
+
+    void Init();
+    void Exit();
+
+    /// @brief Get a text, laid out on first use
+    /// @param font Font config section
+    /// @param string Text content
+    /// @return Text owned by the cache, to be shared with orxGraphic_SetData
+    orxTEXT *GetText(const orxSTRING font, const orxSTRING string);
+
+    /// @brief Display a cached text in an object's graphic
+    /// @return `false` if the object has no graphic or the text can't be created
+    bool SetText(orxOBJECT *object, const orxSTRING font, const orxSTRING string);
+
+    /// @brief Release all texts not used by a graphic
+    void Trim();
+
+#ifdef __orxPROFILER__
+    orxU32 GetHitCount() const;
+    orxU32 GetMissCount() const;
+#endif // __orxPROFILER__
+
+  private:
+    using Key = std::pair<orxSTRINGID, orxSTRINGID>;
+
+    std::map<Key, orxTEXT *> texts{};
+    orxU32 capacity{0};
+
+#ifdef __orxPROFILER__
+    orxU32 hits{0};
+    orxU32 misses{0};
+#endif // __orxPROFILER__
+  };
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+
+#include "planet.h"
+
+namespace game
+{
+  /// Frame timelines written as Chrome trace events (JSON), for
+  /// chrome://tracing or Perfetto
+  ///
+  /// Enabled in profiler builds with `-t <file>` / `--trace <file>`. Records
+  /// frames, rendering, object creations & deletions and the game's profile
+  /// scopes (see Profiler.h) as they happen. Engine markers that ran once in a
+  /// frame (clock, physics, Scroll update, ...) are added from orx's profiler
+  /// history at the start of the next frame, the others become counters.
+  class Trace
+  {
+  public:
+    static Trace &Get();
+
+    /// @brief Register the command line parameter, called before config is loaded
+    void Bootstrap();
+    void Init();
+    void Exit();
+
+#ifdef __orxPROFILER__
+    bool IsRecording() const;
+
+    /// @brief Add a span, times from orxSystem_GetTime
+    void Complete(const orxSTRING name, const orxSTRING category, orxDOUBLE start, orxDOUBLE end);
+
+    /// @brief Add an instant event
+    /// @param model Object model the event is about
+    void Instant(const orxSTRING name, const orxSTRING category, const orxSTRING model);
+
+    /// @brief Add a per-frame counter sample
+    void Counter(const orxSTRING name, orxDOUBLE time, orxU32 count);
+
+  private:
+    static orxSTATUS orxFASTCALL OnParam(orxU32 _u32ParamCount, const orxSTRING _azParams[]);
+    static orxSTATUS orxFASTCALL OnBootstrapEvent(const orxEVENT *_pstEvent);
+    static orxSTATUS orxFASTCALL OnEvent(const orxEVENT *_pstEvent);
+
+    /// @brief Add the engine markers of the frame that started at `frameStart`
+    void ReadProfilerFrame();
+
+    void Append(const orxCHAR *event);
+    void Flush();
+
+    /// Microseconds since the start of the trace
+    orxDOUBLE ToMicroseconds(orxDOUBLE time) const;
+
+    std::string path{};
+    orxFILE *file{orxNULL};
+    std::string buffer{};
+    bool first{true};
+    orxDOUBLE origin{0.0};
+    orxDOUBLE frameStart{-1.0};
+    orxDOUBLE renderStart{0.0};
+#endif // __orxPROFILER__
+  };
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "planet.h"
+
+namespace game
+{
+  /// Sound effect voices, reused instead of creating a sound (and an object)
+  /// for every play
+  ///
+  /// Each sound section gets up to `MaxVoices` voices (1 by default) and a
+  /// `Priority` (0 by default). When a sound is at its cap, its oldest voice
+  /// is restarted. When `Voices.MaxVoices` are playing overall, the oldest
+  /// voice of the lowest priority is stolen, if it's not above the new one's.
+  /// Use `KeepInCache` on short effects so their decoded sample stays loaded,
+  /// and list them in `Voices.PreloadList` so they're decoded at startup.
+  class Voices
+  {
+  public:
+    static Voices &Get();
+
+    void Init();
+    void Exit();
+
+    /// @brief Play a sound effect
+    /// @param sound Sound config section
+    /// @return `false` if the sound can't be created or all voices are busy with higher priorities
+    bool Play(const orxSTRING sound);
+
+    /// @brief Stop & delete all voices
+    void Clear();
+
+  private:
+    struct Voice
+    {
+      orxSOUND *sound{orxNULL};
+      orxDOUBLE startTime{0.0};
+    };
+
+    struct Pool
+    {
+      orxU32 maxVoices{1};
+      orxS32 priority{0};
+      std::vector<Voice> voices{};
+    };
+
+    Pool &GetPool(const orxSTRING sound);
+
+    /// @brief Oldest playing voice of the lowest priority, overall
+    Voice *FindVictim(orxS32 priority, orxU32 &playing);
+
+    /// @brief Create a new voice, its sample is decoded on first use
+    Voice *AddVoice(Pool &pool, const orxSTRING sound);
+    void Start(Voice &voice);
+
+    std::map<orxSTRINGID, Pool> pools{};
+    orxU32 maxVoices{0};
+  };
+}
@@ -5,16 +5,19 @@
 
 #include "orx.h"
 
-#define LZ4_FREESTANDING                    1
 
-#define LZ4_memmove(dst, src, size)         orxMemory_Move((dst), (src), (orxU32)(size))
-#define LZ4_memcpy(dst, src, size)          orxMemory_Copy((dst), (src), (orxU32)(size))
-#define LZ4_memset(dst, data, size)         orxMemory_Set((dst), (data), (orxU32)(size))
+//! Structures
 
-#include "lz4/lz4.c"
-#include "lz4/lz4hc.c"
+typedef struct __orxBUNDLE_MEMORY_USAGE_t
+{
+  orxU64          u64Size;                  // Decompressed buffers currently held
+  orxU64          u64PeakSize;              // Sampled when queried, on top of each thread's own peak
+  orxU64          u64IntermediatePeakSize;  // Largest compressed buffer used while reading
+  orxU64          u64ScratchSize;           // Per-thread compressed buffers currently held
+  orxU64          u64LargestSize;           // Largest decompressed resource
+  const orxSTRING zLargestName;
 
-#undef LZ4_FREESTANDING
+} orxBUNDLE_MEMORY_USAGE;
 
 
 //! Prototypes
@@ -23,6 +26,9 @@ orxSTATUS orxFASTCALL                       orxBundle_Init();
 void orxFASTCALL                            orxBundle_Exit();
 orxBOOL orxFASTCALL                         orxBundle_IsProcessing();
 const orxSTRING orxFASTCALL                 orxBundle_GetOutputName();
+void orxFASTCALL                            orxBundle_GetResourceCounts(orxU32 *_pu32OpenCount, orxU32 *_pu32CloseCount);
+void orxFASTCALL                            orxBundle_GetMemoryUsage(orxBUNDLE_MEMORY_USAGE *_pstUsage); // Sums all threads' usage, to be called from the main thread
+void orxFASTCALL                            orxBundle_SetReadOnce(orxBOOL _bReadOnce);
 
 
 //! Defines
@@ -51,6 +57,19 @@ const orxSTRING orxFASTCALL                 orxBundle_GetOutputName();
 
 #ifdef orxBUNDLE_IMPL
 
+//! LZ4, only compiled along with the implementation
+
+#define LZ4_FREESTANDING                    1
+
+#define LZ4_memmove(dst, src, size)         orxMemory_Move((dst), (src), (orxU32)(size))
+#define LZ4_memcpy(dst, src, size)          orxMemory_Copy((dst), (src), (orxU32)(size))
+#define LZ4_memset(dst, data, size)         orxMemory_Set((dst), (data), (orxU32)(size))
+
+#include "lz4/lz4.c"
+#include "lz4/lz4hc.c"
+
+#undef LZ4_FREESTANDING
+
 #if defined(__orxGCC__)
 
   #pragma GCC diagnostic push
@@ -84,8 +103,29 @@ typedef struct BundleResource
   orxS64        s64Cursor;
   BundleData    stData;
   orxU8        *pu8FinalBuffer;
+  orxS64        s64BufferSize;
+  orxHANDLE     hSource;
+  orxS64        s64EntryOffset;
 } BundleResource;
 
+typedef struct BundleScratch
+{
+  orxU8        *pu8Buffer;
+  orxS64        s64Size;
+} BundleScratch;
+
+// Only written by its own thread, summed up when queried
+typedef struct BundleThreadUsage
+{
+  orxS64          s64Size;                  // Negative when releasing buffers read by another thread
+  orxU64          u64PeakSize;
+  orxU64          u64IntermediatePeakSize;
+  orxU64          u64LargestSize;
+  const orxSTRING zLargestName;
+  orxU32          u32OpenCount;
+  orxU32          u32CloseCount;
+} BundleThreadUsage;
+
 #if __has_include(orxBUNDLE_KZ_INCLUDE_FILENAME)
   #include orxBUNDLE_KZ_INCLUDE_FILENAME
 #endif // __has_include(orxBUNDLE_KZ_INCLUDE_FILENAME)
@@ -98,10 +138,14 @@ typedef struct __orxBUNDLE_t
 {
   orxCHAR       acPrintBuffer[1024];
   orxHASHTABLE *apstResourceTableList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
+  BundleScratch astScratchList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
+  BundleThreadUsage astUsageList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
   orxHASHTABLE *pstToCTable;
   orxHASHTABLE *pstDataTable;
   orxHANDLE     hResource;
   orxU32        u32DataCount;
+  orxU64        u64PeakSize;
+  orxBOOL       bReadOnce;
   orxBOOL       bProcess;
   orxBOOL       bInit;
 
@@ -237,6 +281,18 @@ void orxFASTCALL orxBundle_CommandGetOutputName(orxU32 _u32ArgNumber, const orxC
   return;
 }
 
+static orxINLINE BundleThreadUsage *orxBundle_GetThreadUsage()
+{
+  orxU32 u32ThreadID;
+
+  // Gets current thread ID
+  u32ThreadID = orxThread_GetCurrent();
+  orxASSERT(u32ThreadID != orxU32_UNDEFINED);
+
+  // Done!
+  return &sstBundle.astUsageList[u32ThreadID];
+}
+
 static orxINLINE void orxBundle_ClearResourceTable(orxHASHTABLE *_pstResourceTable)
 {
   orxHANDLE hIterator, hResource;
@@ -1285,8 +1341,9 @@ orxHANDLE orxFASTCALL orxBundle_Open(const orxSTRING _zLocation, orxBOOL _bErase
               // Clears memory
               orxMemory_Zero(pstResource, sizeof(BundleResource));
 
-              // Stores its internal resource
-              pstResource->stData.hResource = hResource;
+              // Stores its source & entry, as the bundle's handle is shared by all its resources on this thread
+              pstResource->hSource        = hResource;
+              pstResource->s64EntryOffset = orxBUNDLE_KU32_HEADER_INTRO_SIZE + u32Index * orxBUNDLE_KU32_HEADER_ENTRY_SIZE;
 
               // Skips to its info
               orxResource_Seek(hResource, orxBUNDLE_KU32_HEADER_INTRO_SIZE + u32Index * orxBUNDLE_KU32_HEADER_ENTRY_SIZE + 8 + 4, orxSEEK_OFFSET_WHENCE_START);
@@ -1295,8 +1352,8 @@ orxHANDLE orxFASTCALL orxBundle_Open(const orxSTRING _zLocation, orxBOOL _bErase
               pstResource->stData.s64Size       = (orxS64)orxResource_ReadU32(hResource);
               pstResource->stData.s64FinalSize  = (orxS64)orxResource_ReadU32(hResource);
 
-              // Skips to its entry
-              orxResource_Seek(hResource, orxBUNDLE_KU32_HEADER_INTRO_SIZE + u32Index * orxBUNDLE_KU32_HEADER_ENTRY_SIZE, orxSEEK_OFFSET_WHENCE_START);
+              // Updates counter
+              orxBundle_GetThreadUsage()->u32OpenCount++;
 
               // Updates result
               hResult = (orxHANDLE)pstResource;
@@ -1325,6 +1382,9 @@ orxHANDLE orxFASTCALL orxBundle_Open(const orxSTRING _zLocation, orxBOOL _bErase
           // Stores its data
           orxMemory_Copy(&(pstResource->stData), &sastBundleDataList[u32Index], sizeof(BundleData));
 
+          // Updates counter
+          orxBundle_GetThreadUsage()->u32OpenCount++;
+
           // Updates result
           hResult = (orxHANDLE)pstResource;
         }
@@ -1339,21 +1399,29 @@ orxHANDLE orxFASTCALL orxBundle_Open(const orxSTRING _zLocation, orxBOOL _bErase
 // Close function: releases all that has been allocated in Open
 void orxFASTCALL orxBundle_Close(orxHANDLE _hResource)
 {
-  BundleResource *pstResource;
+  BundleResource    *pstResource;
+  BundleThreadUsage *pstUsage;
 
-  // Gets resource
+  // Gets resource & this thread's usage
   pstResource = (BundleResource *)_hResource;
+  pstUsage    = orxBundle_GetThreadUsage();
 
   // Has final buffer?
   if(pstResource->pu8FinalBuffer != orxNULL)
   {
     // Frees it
     orxMemory_Free(pstResource->pu8FinalBuffer);
+
+    // Updates memory usage
+    pstUsage->s64Size -= pstResource->s64BufferSize;
   }
 
   // Frees it
   orxMemory_Free(pstResource);
 
+  // Updates counter
+  pstUsage->u32CloseCount++;
+
   // Done!
   return;
 }
@@ -1443,90 +1511,176 @@ orxS64 orxFASTCALL orxBundle_Tell(orxHANDLE _hResource)
   return s64Result;
 }
 
-// Read function: copies the requested amount of data, in bytes, to the given buffer and returns the amount of bytes copied
-orxS64 orxFASTCALL orxBundle_Read(orxHANDLE _hResource, orxS64 _s64Size, void *_pu8Buffer)
+// Decompress function: decrypts & decompresses the resource's content into the given buffer, returns orxFALSE upon failure
+static orxBOOL orxFASTCALL orxBundle_Decompress(BundleResource *_pstResource, orxU8 *_pu8Destination)
 {
-  BundleResource *pstResource;
-  orxS64          s64CopySize;
+  BundleScratch      *pstScratch;
+  BundleThreadUsage  *pstUsage;
+  orxU32              u32ThreadID;
+  orxS64              s64Size;
+  const orxSTRING     zKey;
+  orxU8              *pu8Buffer;
+  orxBOOL             bResult = orxTRUE;
+
+  // Gets this thread's scratch buffer & usage
+  u32ThreadID = orxThread_GetCurrent();
+  pstScratch  = &sstBundle.astScratchList[u32ThreadID];
+  pstUsage    = &sstBundle.astUsageList[u32ThreadID];
+
+  // Too small?
+  if(pstScratch->s64Size < _pstResource->stData.s64Size)
+  {
+    // Has buffer?
+    if(pstScratch->pu8Buffer != orxNULL)
+    {
+      // Frees it, no content to preserve
+      orxMemory_Free(pstScratch->pu8Buffer);
+    }
 
-  // Gets resource
-  pstResource = (BundleResource *)_hResource;
+    // Allocates new one
+    pstScratch->pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)_pstResource->stData.s64Size, orxMEMORY_TYPE_MAIN);
+    orxASSERT(pstScratch->pu8Buffer);
 
-  // No final buffer?
-  if(pstResource->pu8FinalBuffer == orxNULL)
+    // Updates memory usage
+    pstScratch->s64Size = _pstResource->stData.s64Size;
+  }
+
+  // Gets intermediate buffer
+  pu8Buffer = pstScratch->pu8Buffer;
+
+  // Updates memory usage
+  pstUsage->u64IntermediatePeakSize = orxMAX(pstUsage->u64IntermediatePeakSize, (orxU64)_pstResource->stData.s64Size);
+
+  // Gets encryption key
+  zKey = orxConfig_GetEncryptionKey();
+
+  // Has external resource?
+  if(_pstResource->stData.pu8Buffer == orxNULL)
   {
-    orxS64          s64Size;
-    const orxSTRING zKey;
-    orxU8          *pu8Buffer;
+    const orxU8  *pu8Key;
+    orxU8        *pu8Data;
+    orxHANDLE     hResource;
+
+    // Gets it
+    hResource = _pstResource->hSource;
 
-    // Allocates intermediate buffer
-    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)pstResource->stData.s64Size, orxMEMORY_TYPE_TEMP);
-    orxASSERT(pu8Buffer);
+    // Skips to its entry
+    orxResource_Seek(hResource, _pstResource->s64EntryOffset, orxSEEK_OFFSET_WHENCE_START);
 
-    // Gets encryption key
-    zKey = orxConfig_GetEncryptionKey();
+    // Store its ID
+    _pstResource->stData.stNameID = orxResource_ReadU64(hResource);
 
-    // Has external resource?
-    if(pstResource->stData.pu8Buffer == orxNULL)
+    // Skips to content
+    orxResource_Seek(hResource, (orxS64)orxResource_ReadU32(hResource), orxSEEK_OFFSET_WHENCE_START);
+
+    // Reads its content
+    s64Size = orxResource_Read(hResource, _pstResource->stData.s64Size, pu8Buffer, orxNULL, orxNULL);
+    orxASSERT(s64Size == _pstResource->stData.s64Size);
+
+    // Decrypts data
+    for(pu8Key = (const orxU8 *)zKey, pu8Data = pu8Buffer;
+        pu8Data < pu8Buffer + _pstResource->stData.s64Size;
+        pu8Key = (*pu8Key == orxCHAR_NULL) ? (const orxU8 *)zKey : pu8Key + 1, pu8Data++)
     {
-      const orxU8  *pu8Key;
-      orxU8        *pu8Data;
-      orxHANDLE     hResource;
+      *pu8Data ^= *pu8Key;
+    }
+  }
+  else
+  {
+    const orxU8  *pu8Key, *pu8Src;
+    orxU8        *pu8Dst;
 
-      // Gets it
-      hResource = pstResource->stData.hResource;
+    // Decrypts data
+    for(pu8Key = (const orxU8 *)zKey, pu8Src = _pstResource->stData.pu8Buffer, pu8Dst = pu8Buffer;
+        pu8Src < _pstResource->stData.pu8Buffer + _pstResource->stData.s64Size;
+        pu8Key = (*pu8Key == orxCHAR_NULL) ? (const orxU8 *)zKey : pu8Key + 1, pu8Src++, pu8Dst++)
+    {
+      *pu8Dst = *pu8Src ^ *pu8Key;
+    }
+  }
 
-      // Store its ID
-      pstResource->stData.stNameID = orxResource_ReadU64(hResource);
+  // Decompresses data
+  s64Size = (orxS64)LZ4_decompress_safe((const char *)pu8Buffer, (char *)_pu8Destination, (int)_pstResource->stData.s64Size, (int)_pstResource->stData.s64FinalSize);
 
-      // Skips to content
-      orxResource_Seek(hResource, (orxS64)orxResource_ReadU32(hResource), orxSEEK_OFFSET_WHENCE_START);
+  // Failure?
+  if(s64Size != _pstResource->stData.s64FinalSize)
+  {
+    // Logs message
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, orxANSI_KZ_COLOR_FG_YELLOW "[Bundle]" orxANSI_KZ_COLOR_FG_RED " Can't decompress resource " orxANSI_KZ_COLOR_FG_GREEN "[%s]" orxANSI_KZ_COLOR_FG_RED ": invalid decryption key or corrupted data.", orxString_GetFromID(_pstResource->stData.stNameID));
 
-      // Reads its content
-      s64Size = orxResource_Read(hResource, pstResource->stData.s64Size, pu8Buffer, orxNULL, orxNULL);
-      orxASSERT(s64Size == pstResource->stData.s64Size);
+    // Updates its final size
+    _pstResource->stData.s64FinalSize = 0;
 
-      // Decrypts data
-      for(pu8Key = (const orxU8 *)zKey, pu8Data = pu8Buffer;
-          pu8Data < pu8Buffer + pstResource->stData.s64Size;
-          pu8Key = (*pu8Key == orxCHAR_NULL) ? (const orxU8 *)zKey : pu8Key + 1, pu8Data++)
-      {
-        *pu8Data ^= *pu8Key;
-      }
-    }
-    else
+    // Updates result
+    bResult = orxFALSE;
+  }
+  // Largest so far?
+  else if((orxU64)s64Size > pstUsage->u64LargestSize)
+  {
+    // Stores it
+    pstUsage->u64LargestSize  = (orxU64)s64Size;
+    pstUsage->zLargestName    = orxString_GetFromID(_pstResource->stData.stNameID);
+  }
+
+  // Done!
+  return bResult;
+}
+
+// Read function: copies the requested amount of data, in bytes, to the given buffer and returns the amount of bytes copied
+orxS64 orxFASTCALL orxBundle_Read(orxHANDLE _hResource, orxS64 _s64Size, void *_pu8Buffer)
+{
+  BundleResource    *pstResource;
+  BundleThreadUsage *pstUsage;
+  orxS64             s64CopySize;
+
+  // Profiles
+  orxPROFILER_PUSH_MARKER("orxBundle_Read");
+
+  // Gets resource
+  pstResource = (BundleResource *)_hResource;
+
+  // Nothing left or nothing requested?
+  if((pstResource->s64Cursor >= pstResource->stData.s64FinalSize) || (_s64Size <= 0))
+  {
+    // Profiles
+    orxPROFILER_POP_MARKER();
+
+    // Done!
+    return 0;
+  }
+
+  // No final buffer?
+  if(pstResource->pu8FinalBuffer == orxNULL)
+  {
+    // Whole content requested at once?
+    if((pstResource->s64Cursor == 0) && (_s64Size >= pstResource->stData.s64FinalSize))
     {
-      const orxU8  *pu8Key, *pu8Src;
-      orxU8        *pu8Dst;
+      // Decompresses it directly in the caller's buffer, no final buffer needed
+      orxBundle_Decompress(pstResource, (orxU8 *)_pu8Buffer);
 
-      // Decrypts data
-      for(pu8Key = (const orxU8 *)zKey, pu8Src = pstResource->stData.pu8Buffer, pu8Dst = pu8Buffer;
-          pu8Src < pstResource->stData.pu8Buffer + pstResource->stData.s64Size;
-          pu8Key = (*pu8Key == orxCHAR_NULL) ? (const orxU8 *)zKey : pu8Key + 1, pu8Src++, pu8Dst++)
-      {
-        *pu8Dst = *pu8Src ^ *pu8Key;
-      }
+      // Updates cursor
+      s64CopySize = pstResource->stData.s64FinalSize;
+      pstResource->s64Cursor = s64CopySize;
+
+      // Profiles
+      orxPROFILER_POP_MARKER();
+
+      // Done!
+      return s64CopySize;
     }
 
     // Allocates final buffer
     pstResource->pu8FinalBuffer = (orxU8 *)orxMemory_Allocate((orxU32)pstResource->stData.s64FinalSize, orxMEMORY_TYPE_MAIN);
     orxASSERT(pstResource->pu8FinalBuffer != orxNULL);
 
-    // Decompresses data
-    s64Size = (orxS64)LZ4_decompress_safe((const char *)pu8Buffer, (char *)pstResource->pu8FinalBuffer, (int)pstResource->stData.s64Size, (int)pstResource->stData.s64FinalSize);
-
-    // Failure?
-    if(s64Size != pstResource->stData.s64FinalSize)
-    {
-      // Logs message
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, orxANSI_KZ_COLOR_FG_YELLOW "[Bundle]" orxANSI_KZ_COLOR_FG_RED " Can't decompress resource " orxANSI_KZ_COLOR_FG_GREEN "[%s]" orxANSI_KZ_COLOR_FG_RED ": invalid decryption key or corrupted data.", orxString_GetFromID(pstResource->stData.stNameID));
+    // Updates memory usage
+    pstResource->s64BufferSize = pstResource->stData.s64FinalSize;
+    pstUsage                    = orxBundle_GetThreadUsage();
+    pstUsage->s64Size          += pstResource->s64BufferSize;
+    pstUsage->u64PeakSize       = orxMAX(pstUsage->u64PeakSize, (orxU64)orxMAX(pstUsage->s64Size, 0));
 
-      // Updates its final size
-      pstResource->stData.s64FinalSize = 0;
-    }
-
-    // Deletes intermediate buffer
-    orxMemory_Free(pu8Buffer);
+    // Decompresses data
+    orxBundle_Decompress(pstResource, pstResource->pu8FinalBuffer);
   }
 
   // Gets actual copy size to prevent any out-of-bound access
@@ -1542,6 +1696,21 @@ orxS64 orxFASTCALL orxBundle_Read(orxHANDLE _hResource, orxS64 _s64Size, void *_
   // Updates cursor
   pstResource->s64Cursor += s64CopySize;
 
+  // Read once and reached the end?
+  if((sstBundle.bReadOnce != orxFALSE) && (pstResource->s64Cursor >= pstResource->stData.s64FinalSize))
+  {
+    // Frees final buffer, it'll get decompressed again if the consumer seeks back
+    orxMemory_Free(pstResource->pu8FinalBuffer);
+    pstResource->pu8FinalBuffer = orxNULL;
+
+    // Updates memory usage
+    orxBundle_GetThreadUsage()->s64Size -= pstResource->s64BufferSize;
+    pstResource->s64BufferSize = 0;
+  }
+
+  // Profiles
+  orxPROFILER_POP_MARKER();
+
   // Done!
   return s64CopySize;
 }
@@ -1562,6 +1731,10 @@ orxSTATUS orxFASTCALL orxBundle_Init()
     sstBundle.pstDataTable    = orxNULL;
     sstBundle.hResource       = orxHANDLE_UNDEFINED;
     sstBundle.u32DataCount    = (sastBundleDataList != orxNULL) ? orxARRAY_GET_ITEM_COUNT(sastBundleDataList) : 0;
+    sstBundle.u64PeakSize     = 0;
+    orxMemory_Zero(sstBundle.astScratchList, sizeof(sstBundle.astScratchList));
+    orxMemory_Zero(sstBundle.astUsageList, sizeof(sstBundle.astUsageList));
+    sstBundle.bReadOnce       = orxFALSE;
     sstBundle.bProcess        = orxFALSE;
 
     // Inits our bundle resource type
@@ -1688,6 +1861,18 @@ void orxFASTCALL orxBundle_Exit()
       sstBundle.apstResourceTableList[i] = orxNULL;
     }
 
+    // For all scratch buffers
+    for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sstBundle.astScratchList); i++)
+    {
+      // Has buffer?
+      if(sstBundle.astScratchList[i].pu8Buffer != orxNULL)
+      {
+        // Frees it
+        orxMemory_Free(sstBundle.astScratchList[i].pu8Buffer);
+      }
+    }
+    orxMemory_Zero(sstBundle.astScratchList, sizeof(sstBundle.astScratchList));
+
     // Updates status
     sstBundle.bInit = orxFALSE;
   }
@@ -1705,6 +1890,75 @@ const orxSTRING orxFASTCALL orxBundle_GetOutputName()
   return (sstBundle.hResource != orxHANDLE_UNDEFINED) ? orxResource_GetPath(orxResource_GetLocation(sstBundle.hResource)) : orxSTRING_EMPTY;
 }
 
+void orxFASTCALL orxBundle_GetResourceCounts(orxU32 *_pu32OpenCount, orxU32 *_pu32CloseCount)
+{
+  orxU32 i;
+
+  // Sums counts of opened & closed bundled resources over all threads
+  *_pu32OpenCount   = 0;
+  *_pu32CloseCount  = 0;
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sstBundle.astUsageList); i++)
+  {
+    *_pu32OpenCount  += sstBundle.astUsageList[i].u32OpenCount;
+    *_pu32CloseCount += sstBundle.astUsageList[i].u32CloseCount;
+  }
+
+  // Done!
+  return;
+}
+
+void orxFASTCALL orxBundle_SetReadOnce(orxBOOL _bReadOnce)
+{
+  // Stores it
+  sstBundle.bReadOnce = _bReadOnce;
+
+  // Done!
+  return;
+}
+
+void orxFASTCALL orxBundle_GetMemoryUsage(orxBUNDLE_MEMORY_USAGE *_pstUsage)
+{
+  orxS64 s64Size = 0;
+  orxU32 i;
+
+  // Checks
+  orxASSERT(_pstUsage != orxNULL);
+
+  // Clears it
+  orxMemory_Zero(_pstUsage, sizeof(orxBUNDLE_MEMORY_USAGE));
+  _pstUsage->zLargestName = orxSTRING_EMPTY;
+
+  // For all threads
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sstBundle.astUsageList); i++)
+  {
+    const BundleThreadUsage *pstUsage;
+
+    // Gets its usage
+    pstUsage = &sstBundle.astUsageList[i];
+
+    // Sums sizes
+    s64Size                   += pstUsage->s64Size;
+    _pstUsage->u64ScratchSize += (orxU64)sstBundle.astScratchList[i].s64Size;
+
+    // Keeps largest ones
+    _pstUsage->u64PeakSize              = orxMAX(_pstUsage->u64PeakSize, pstUsage->u64PeakSize);
+    _pstUsage->u64IntermediatePeakSize  = orxMAX(_pstUsage->u64IntermediatePeakSize, pstUsage->u64IntermediatePeakSize);
+    if(pstUsage->u64LargestSize > _pstUsage->u64LargestSize)
+    {
+      _pstUsage->u64LargestSize = pstUsage->u64LargestSize;
+      _pstUsage->zLargestName   = pstUsage->zLargestName;
+    }
+  }
+
+  // Updates total & its peak, sampled by the calls on top of each thread's own peak
+  _pstUsage->u64Size      = (orxU64)orxMAX(s64Size, 0);
+  sstBundle.u64PeakSize   = orxMAX(sstBundle.u64PeakSize, orxMAX(_pstUsage->u64Size, _pstUsage->u64PeakSize));
+  _pstUsage->u64PeakSize  = sstBundle.u64PeakSize;
+
+  // Done!
+  return;
+}
+
 #if defined(__orxGCC__)
 
   #pragma GCC diagnostic pop
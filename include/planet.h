@@ -27,6 +27,9 @@ private:
                 void            Exit();
                 void            BindObjects();
 
+                void            OnObjectCreate(ScrollObject *_poObject);
+                void            OnObjectDelete(ScrollObject *_poObject);
+
 
 private:
 };
@@ -0,0 +1,332 @@
+/**
+ * @file Atlas.cpp
+ * @date 19-Oct-2026
+ */
+
+#include <algorithm>
+#include <utility>
+
+#include "Atlas.h"
+#include "Extensions.h"
+
+namespace
+{
+  constexpr orxU32 bytesPerPixel = 4;
+
+  /// @brief Box filter one axis of an RGBA float image
+  /// @param stride Distance between two pixels along the filtered axis, in floats
+  /// @param lineStride Distance between two lines, in floats
+  void FilterAxis(const std::vector<orxFLOAT> &source, orxU32 sourceSize, orxU32 stride, orxU32 lineStride, orxU32 lineCount, std::vector<orxFLOAT> &destination, orxU32 size, orxU32 destinationStride, orxU32 destinationLineStride)
+  {
+    const auto ratio = static_cast<orxFLOAT>(sourceSize) / static_cast<orxFLOAT>(size);
+    for (orxU32 line = 0; line < lineCount; line++)
+    {
+      for (orxU32 i = 0; i < size; i++)
+      {
+        // Averages all source pixels covered by the destination one, weighted by coverage
+        const auto begin = i * ratio, end = (i + 1) * ratio;
+        orxFLOAT sum[bytesPerPixel] = {};
+        for (auto j = orxF2U(begin); j < sourceSize && orxU2F(j) < end; j++)
+        {
+          const auto weight = orxMIN(end, orxU2F(j + 1)) - orxMAX(begin, orxU2F(j));
+          const auto pixel = &source[line * lineStride + j * stride];
+          for (orxU32 c = 0; c < bytesPerPixel; c++)
+          {
+            sum[c] += pixel[c] * weight;
+          }
+        }
+        const auto pixel = &destination[line * destinationLineStride + i * destinationStride];
+        for (orxU32 c = 0; c < bytesPerPixel; c++)
+        {
+          pixel[c] = sum[c] / ratio;
+        }
+      }
+    }
+  }
+
+  /// @brief Resize an RGBA image with a box filter, in premultiplied alpha so
+  /// transparent edges don't bleed dark fringes
+  void Downscale(const std::vector<orxU8> &source, orxU32 sourceWidth, orxU32 sourceHeight, std::vector<orxU8> &destination, orxU32 width, orxU32 height)
+  {
+    std::vector<orxFLOAT> premultiplied(source.size());
+    for (size_t i = 0; i < source.size(); i += bytesPerPixel)
+    {
+      const auto alpha = source[i + 3] / 255.0f;
+      premultiplied[i] = source[i] * alpha;
+      premultiplied[i + 1] = source[i + 1] * alpha;
+      premultiplied[i + 2] = source[i + 2] * alpha;
+      premultiplied[i + 3] = source[i + 3];
+    }
+
+    // Horizontally, then vertically
+    std::vector<orxFLOAT> columns(static_cast<size_t>(width) * sourceHeight * bytesPerPixel);
+    FilterAxis(premultiplied, sourceWidth, bytesPerPixel, sourceWidth * bytesPerPixel, sourceHeight, columns, width, bytesPerPixel, width * bytesPerPixel);
+    std::vector<orxFLOAT> result(static_cast<size_t>(width) * height * bytesPerPixel);
+    FilterAxis(columns, sourceHeight, width * bytesPerPixel, bytesPerPixel, width, result, height, width * bytesPerPixel, bytesPerPixel);
+
+    destination.resize(result.size());
+    for (size_t i = 0; i < result.size(); i += bytesPerPixel)
+    {
+      const auto alpha = result[i + 3];
+      const auto unpremultiply = (alpha > 0.0f) ? 255.0f / alpha : 0.0f;
+      for (orxU32 c = 0; c < 3; c++)
+      {
+        destination[i + c] = static_cast<orxU8>(orxMIN(result[i + c] * unpremultiply + 0.5f, 255.0f));
+      }
+      destination[i + 3] = static_cast<orxU8>(orxMIN(alpha + 0.5f, 255.0f));
+    }
+  }
+
+  /// @brief Location of a generated file in a writable storage
+  const orxSTRING LocateOutput(const orxSTRING group, const orxSTRING storageKey, const orxSTRING name)
+  {
+    return orxResource_LocateInStorage(group, orxConfig_GetString(storageKey), name);
+  }
+}
+
+game::Atlas &game::Atlas::Get()
+{
+  static Atlas instance;
+  return instance;
+}
+
+void game::Atlas::Init(bool build)
+{
+  if (build)
+  {
+    Build();
+  }
+
+  orxConfig_PushSection("Atlas");
+  const auto config = orxConfig_GetString("Config");
+  orxConfig_PopSection();
+
+  // Graphics keep their own textures unless an atlas has just been generated or bundled
+  const auto location = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, config);
+  if (location != orxNULL && (build || IsBundled(location)))
+  {
+    orxConfig_Load(config);
+  }
+}
+
+bool game::Atlas::Pack(std::vector<Sprite> &sprites, orxU32 maxSize, orxU32 padding, orxU32 &width, orxU32 &height)
+{
+  std::vector<Sprite *> order;
+  for (auto &sprite : sprites)
+  {
+    order.push_back(&sprite);
+  }
+  std::stable_sort(order.begin(), order.end(), [](const Sprite *a, const Sprite *b)
+                   { return a->height > b->height; });
+
+  // Shelves are as tall as their first (tallest) sprite
+  orxU32 x = 0, y = 0, shelfHeight = 0;
+  width = height = 0;
+  for (auto sprite : order)
+  {
+    if (x + sprite->width > maxSize)
+    {
+      x = 0;
+      y += shelfHeight + padding;
+      shelfHeight = 0;
+    }
+    if (sprite->width > maxSize || y + sprite->height > maxSize)
+    {
+      return false;
+    }
+
+    sprite->x = x;
+    sprite->y = y;
+    x += sprite->width + padding;
+    shelfHeight = orxMAX(shelfHeight, sprite->height);
+    width = orxMAX(width, sprite->x + sprite->width);
+    height = orxMAX(height, sprite->y + sprite->height);
+  }
+  return true;
+}
+
+bool game::Atlas::Load(Sprite &sprite, orxFLOAT oversample)
+{
+  // Footprint scale, from the object config sharing the graphic's section
+  orxConfig_PushSection(sprite.graphic);
+  auto scale = orxFLOAT_1;
+  if (orxConfig_HasValue("Scale"))
+  {
+    orxVECTOR objectScale;
+    if (orxConfig_GetVector("Scale", &objectScale) == orxNULL)
+    {
+      orxVector_SetAll(&objectScale, orxConfig_GetFloat("Scale"));
+    }
+    scale = orxMIN(orxMAX(orxMath_Abs(objectScale.fX), orxMath_Abs(objectScale.fY)) * oversample, orxFLOAT_1);
+  }
+  orxConfig_PopSection();
+
+  auto bitmap = orxDisplay_LoadBitmap(sprite.texture);
+  if (bitmap == orxNULL)
+  {
+    orxLOG("[ATLAS] Can't load <%s> for graphic <%s>.", sprite.texture, sprite.graphic);
+    return false;
+  }
+
+  orxFLOAT width, height;
+  orxDisplay_GetBitmapSize(bitmap, &width, &height);
+  sprite.sourceWidth = orxF2U(width);
+  sprite.sourceHeight = orxF2U(height);
+
+  std::vector<orxU8> pixels(static_cast<size_t>(sprite.sourceWidth) * sprite.sourceHeight * bytesPerPixel);
+  const auto ok = orxDisplay_GetBitmapData(bitmap, pixels.data(), static_cast<orxU32>(pixels.size())) != orxSTATUS_FAILURE;
+  orxDisplay_DeleteBitmap(bitmap);
+  if (!ok)
+  {
+    orxLOG("[ATLAS] Can't read pixels of <%s>.", sprite.texture);
+    return false;
+  }
+
+  sprite.width = orxMAX(orxF2U(orxMath_Ceil(width * scale)), 1u);
+  sprite.height = orxMAX(orxF2U(orxMath_Ceil(height * scale)), 1u);
+  if (sprite.width == sprite.sourceWidth && sprite.height == sprite.sourceHeight)
+  {
+    sprite.pixels = std::move(pixels);
+  }
+  else
+  {
+    Downscale(pixels, sprite.sourceWidth, sprite.sourceHeight, sprite.pixels, sprite.width, sprite.height);
+  }
+  return true;
+}
+
+bool game::Atlas::Build() const
+{
+  const auto startTime = orxSystem_GetTime();
+
+  orxConfig_PushSection("Atlas");
+  const auto texture = orxString_Store(orxConfig_GetString("Texture"));
+  const auto maxSize = orxConfig_GetU32("MaxSize");
+  const auto padding = orxConfig_GetU32("Padding");
+  const auto oversample = orxConfig_HasValue("Oversample") ? orxConfig_GetFloat("Oversample") : orxFLOAT_1;
+  const auto textureLocation = LocateOutput(orxTEXTURE_KZ_RESOURCE_GROUP, "TextureStorage", texture);
+
+  std::vector<Sprite> sprites;
+  for (orxS32 i = 0, count = orxConfig_GetListCount("GraphicList"); i < count; i++)
+  {
+    Sprite sprite;
+    sprite.graphic = orxString_Store(orxConfig_GetListString("GraphicList", i));
+    orxConfig_PushSection(sprite.graphic);
+    sprite.texture = orxString_Store(orxConfig_GetString("Texture"));
+    orxConfig_PopSection();
+    sprites.push_back(sprite);
+  }
+  orxConfig_PopSection();
+
+  if (textureLocation == orxNULL)
+  {
+    orxLOG("[ATLAS] Can't locate output texture <%s>.", texture);
+    return false;
+  }
+
+  // Loads synchronously, the pixels are needed right away
+  const auto tempBitmap = orxDisplay_GetTempBitmap();
+  orxDisplay_SetTempBitmap(orxNULL);
+
+  auto ok = true;
+  size_t sourceBytes = 0;
+  for (auto &sprite : sprites)
+  {
+    ok = Load(sprite, oversample);
+    if (!ok)
+    {
+      break;
+    }
+    sourceBytes += static_cast<size_t>(sprite.sourceWidth) * sprite.sourceHeight * bytesPerPixel;
+  }
+
+  orxU32 width = 0, height = 0;
+  if (ok && !Pack(sprites, maxSize, padding, width, height))
+  {
+    orxLOG("[ATLAS] Textures don't fit in %ux%u.", maxSize, maxSize);
+    ok = false;
+  }
+
+  // Copies all sprites into a transparent atlas, row by row
+  std::vector<orxU8> pixels;
+  if (ok && !sprites.empty())
+  {
+    pixels.resize(static_cast<size_t>(width) * height * bytesPerPixel, 0);
+    for (const auto &sprite : sprites)
+    {
+      const auto rowSize = sprite.width * bytesPerPixel;
+      for (orxU32 row = 0; row < sprite.height; row++)
+      {
+        orxMemory_Copy(&pixels[(static_cast<size_t>(sprite.y + row) * width + sprite.x) * bytesPerPixel], &sprite.pixels[static_cast<size_t>(row) * rowSize], rowSize);
+      }
+    }
+
+    auto atlas = orxDisplay_CreateBitmap(width, height);
+    ok = atlas != orxNULL && orxDisplay_SetBitmapData(atlas, pixels.data(), static_cast<orxU32>(pixels.size())) != orxSTATUS_FAILURE && orxDisplay_SaveBitmap(atlas, orxResource_GetPath(textureLocation)) != orxSTATUS_FAILURE;
+    if (atlas != orxNULL)
+    {
+      orxDisplay_DeleteBitmap(atlas);
+    }
+  }
+
+  orxDisplay_SetTempBitmap(tempBitmap);
+
+  ok = ok && WriteConfig(sprites);
+
+  if (ok)
+  {
+    // Sources were only read for packing, keeps them out of the bundle
+    orxConfig_PushSection("Bundle");
+    for (const auto &sprite : sprites)
+    {
+      orxConfig_AppendListString("ExcludeList", &sprite.texture, 1);
+    }
+    orxConfig_PopSection();
+
+    orxLOG("[ATLAS] Packed %u textures into <%s> (%ux%u, %uKB from %uKB) in %.2fms.", (orxU32)sprites.size(), texture, width, height, (orxU32)(pixels.size() / 1024), (orxU32)(sourceBytes / 1024), (orxSystem_GetTime() - startTime) * 1000.0);
+  }
+  else
+  {
+    orxLOG("[ATLAS] Failed packing <%s>, graphics keep their own textures.", texture);
+  }
+  return ok;
+}
+
+bool game::Atlas::WriteConfig(const std::vector<Sprite> &sprites) const
+{
+  orxConfig_PushSection("Atlas");
+  const auto texture = orxConfig_GetString("Texture");
+  const auto config = orxConfig_GetString("Config");
+  const auto location = LocateOutput(orxCONFIG_KZ_RESOURCE_GROUP, "ConfigStorage", config);
+  orxConfig_PopSection();
+
+  const auto output = (location != orxNULL) ? orxResource_Open(location, orxTRUE) : orxHANDLE_UNDEFINED;
+  if (output == orxHANDLE_UNDEFINED)
+  {
+    orxLOG("[ATLAS] Can't open <%s> for writing.", config);
+    return false;
+  }
+
+  orxCHAR buffer[256];
+  const auto write = [&buffer, output](orxS32 length)
+  {
+    orxResource_Write(output, static_cast<orxS64>(length), buffer, orxNULL, orxNULL);
+  };
+
+  write(orxString_NPrint(buffer, sizeof(buffer), "; Generated by the atlas packer when bundling, do not edit\r\n"));
+  for (const auto &sprite : sprites)
+  {
+    write(orxString_NPrint(buffer, sizeof(buffer),
+                           "\r\n[%s]\r\nTexture         = %s\r\nTextureOrigin   = (%u, %u)\r\nTextureSize     = (%u, %u)\r\n",
+                           sprite.graphic, texture, sprite.x, sprite.y, sprite.width, sprite.height));
+
+    // Downscaled sprites are stretched back to their original size
+    if (sprite.width != sprite.sourceWidth || sprite.height != sprite.sourceHeight)
+    {
+      write(orxString_NPrint(buffer, sizeof(buffer), "Size            = (%u, %u)\r\n", sprite.sourceWidth, sprite.sourceHeight));
+    }
+  }
+
+  orxResource_Close(output);
+  return true;
+}
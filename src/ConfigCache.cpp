@@ -0,0 +1,123 @@
+/**
+ * @file ConfigCache.cpp
+ * @date 19-Oct-2026
+ */
+
+#include "ConfigCache.h"
+#include "Extensions.h"
+
+game::ConfigCache &game::ConfigCache::Get()
+{
+  static ConfigCache instance;
+  return instance;
+}
+
+void game::ConfigCache::SetArgs(int argc, char **argv)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (orxString_Compare(argv[i], "-b") == 0 || orxString_Compare(argv[i], "--bundle") == 0)
+    {
+      bundling = true;
+    }
+  }
+}
+
+bool game::ConfigCache::Bootstrap()
+{
+  if (bundling)
+  {
+    // Built once the bundle extension has reloaded config from its source files
+    orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, &ConfigCache::OnBootstrapEvent);
+    orxEvent_SetHandlerIDFlags(&ConfigCache::OnBootstrapEvent, orxEVENT_TYPE_SYSTEM, orxNULL, orxEVENT_GET_FLAG(orxSYSTEM_EVENT_PARAM_READY), orxEVENT_KU32_MASK_ID_ALL);
+    return false;
+  }
+
+  const auto cache = GetName();
+  const orxSTRING location = (cache != orxNULL) ? orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, cache) : orxNULL;
+  if (location == orxNULL || !IsBundled(location))
+  {
+    return false;
+  }
+
+  if (orxConfig_Load(cache) == orxSTATUS_FAILURE)
+  {
+    orxLOG("[CONFIGCACHE] Can't load <%s>, loading config files instead.", cache);
+    orxConfig_Clear(orxNULL);
+    return false;
+  }
+
+  // Still bootstrapping: only engine commands can be evaluated, the game registers its own in planet::Init
+  orxConfig_PushSection("ConfigCache");
+  for (orxS32 i = 0, count = orxConfig_GetListCount("LiveConfig"); i < count; i++)
+  {
+    orxConfig_Load(orxConfig_GetListString("LiveConfig", i));
+  }
+  orxConfig_PopSection();
+
+  return true;
+}
+
+orxSTATUS orxFASTCALL game::ConfigCache::OnBootstrapEvent(const orxEVENT *_pstEvent)
+{
+  Get().Build();
+  return orxSTATUS_SUCCESS;
+}
+
+orxBOOL orxFASTCALL game::ConfigCache::SaveFilter(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+{
+  // Only keeps sections coming from config files, not the ones created at runtime
+  if (_zKeyName == orxNULL)
+  {
+    const orxSTRING origin = orxConfig_GetOrigin(_zSectionName);
+    return (origin != orxNULL && *origin != orxCHAR_NULL) ? orxTRUE : orxFALSE;
+  }
+  return orxTRUE;
+}
+
+void game::ConfigCache::Build()
+{
+  const auto cache = GetName();
+  if (cache == orxNULL)
+  {
+    return;
+  }
+
+  orxConfig_PushSection("ConfigCache");
+  const orxSTRING location = orxResource_LocateInStorage(orxCONFIG_KZ_RESOURCE_GROUP, orxConfig_GetString("Storage"), cache);
+  orxConfig_PopSection();
+
+  const orxSTRING path = (location != orxNULL) ? orxResource_GetPath(location) : orxNULL;
+  if (path == orxNULL || orxConfig_Save(path, orxFALSE, &ConfigCache::SaveFilter) == orxSTATUS_FAILURE)
+  {
+    orxLOG("[CONFIGCACHE] Can't save <%s>.", cache);
+    return;
+  }
+
+  // Bundled along with everything else that was located
+  orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, cache);
+  orxLOG("[CONFIGCACHE] Saved <%s>.", path);
+}
+
+const orxSTRING game::ConfigCache::GetName()
+{
+  const orxSTRING main = orxConfig_GetMainFileName();
+  if (main == orxNULL || *main == orxCHAR_NULL)
+  {
+    return orxNULL;
+  }
+
+  // Swaps the extension
+  orxString_NPrint(name, sizeof(name), "%s", main);
+  for (orxS32 i = static_cast<orxS32>(orxString_GetLength(name)) - 1; i >= 0 && name[i] != '/' && name[i] != '\\'; i--)
+  {
+    if (name[i] == '.')
+    {
+      name[i] = orxCHAR_NULL;
+      break;
+    }
+  }
+  const auto length = orxString_GetLength(name);
+  orxString_NPrint(name + length, sizeof(name) - length, ".cache.ini");
+  return name;
+}
@@ -0,0 +1,286 @@
+/**
+ * @file Memory.cpp
+ * @date 19-Oct-2026
+ */
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "Extensions.h"
+#include "Memory.h"
+#include "Metrics.h"
+
+namespace
+{
+  using Subsystem = game::Memory::Subsystem;
+
+  struct Info
+  {
+    const orxSTRING name;
+    const orxSTRING budgetKey;
+  };
+
+  const Info infos[] = {
+      {"Bundle", "BundleBudget"},
+      {"BundleScratch", "BundleScratchBudget"},
+      {"ScrollBanks", "ScrollBanksBudget"},
+      {"Textures", "TextureBudget"},
+      {"Sounds", "SoundBudget"},
+  };
+  static_assert(sizeof(infos) / sizeof(infos[0]) == static_cast<size_t>(Subsystem::Count), "One info per subsystem");
+
+  /// Offenders listed per subsystem
+  constexpr size_t offenderCount = 3;
+
+  /// Sounds are estimated as 16-bit stereo at 44.1kHz when the engine doesn't track audio memory
+  constexpr orxDOUBLE soundBytesPerSecond = 44100.0 * 2.0 * 2.0;
+
+  orxDOUBLE ToKB(orxU64 size)
+  {
+    return static_cast<orxDOUBLE>(size) / 1024.0;
+  }
+
+  orxU64 GetTextureSize(const orxTEXTURE *texture)
+  {
+    orxFLOAT width, height;
+    orxTexture_GetSize(texture, &width, &height);
+    return static_cast<orxU64>(width) * static_cast<orxU64>(height) * 4;
+  }
+
+  /// @brief Sounds of a same config section share their sample, only counts each section once
+  orxU64 GetSoundsSize()
+  {
+    orxU64 size = 0;
+#ifdef __orxPROFILER__
+    orxU32 count, peakCount;
+    orxU64 peakSize, operations;
+    if (orxMemory_GetUsage(orxMEMORY_TYPE_AUDIO, &count, &peakCount, &size, &peakSize, &operations) != orxSTATUS_FAILURE)
+    {
+      return size;
+    }
+#endif // __orxPROFILER__
+    std::set<orxSTRINGID> seen;
+    for (auto sound = orxSOUND(orxStructure_GetFirst(orxSTRUCTURE_ID_SOUND)); sound; sound = orxSOUND(orxStructure_GetNext(sound)))
+    {
+      const orxSTRINGID id = orxString_GetID(orxSound_GetName(sound));
+      if (!orxSound_IsStream(sound) && seen.insert(id).second)
+      {
+        size += static_cast<orxU64>(orxSound_GetDuration(sound) * soundBytesPerSecond);
+      }
+    }
+    return size;
+  }
+
+  /// Memory.Report
+  void orxFASTCALL CommandReport(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    game::Memory::Get().Update();
+    game::Memory::Get().Report();
+    _pstResult->bValue = orxTRUE;
+  }
+}
+
+game::Memory &game::Memory::Get()
+{
+  static Memory instance;
+  return instance;
+}
+
+void game::Memory::Init()
+{
+  static const orxCOMMAND_VAR_DEF result = {"Success", orxCOMMAND_VAR_TYPE_BOOL};
+  orxCommand_Register("Memory.Report", &CommandReport, 0, 0, orxNULL, &result);
+
+  orxConfig_PushSection("Memory");
+  checkPeriod = orxConfig_GetFloat("CheckPeriod");
+  for (size_t i = 0; i < static_cast<size_t>(Subsystem::Count); i++)
+  {
+    usages[i] = {};
+    usages[i].budget = orxConfig_GetU64(infos[i].budgetKey) * 1024;
+  }
+  orxConfig_PopSection();
+
+  // Current & peak sizes, in KB
+  auto &metrics = Metrics::Get();
+  for (size_t i = 0; i < static_cast<size_t>(Subsystem::Count); i++)
+  {
+    orxCHAR name[64];
+    orxString_NPrint(name, sizeof(name), "%sKB", infos[i].name);
+    metrics.AddGauge(orxString_Store(name), [this, i]()
+                     { return ToKB(usages[i].size); });
+    orxString_NPrint(name, sizeof(name), "%sPeakKB", infos[i].name);
+    metrics.AddGauge(orxString_Store(name), [this, i]()
+                     { return ToKB(usages[i].peak); });
+  }
+
+  Update();
+  nextCheck = orxSystem_GetTime() + checkPeriod;
+
+  orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, &Memory::OnEvent);
+  orxEvent_SetHandlerIDFlags(&Memory::OnEvent, orxEVENT_TYPE_SYSTEM, orxNULL, orxEVENT_GET_FLAG(orxSYSTEM_EVENT_GAME_LOOP_STOP), orxEVENT_KU32_MASK_ID_ALL);
+}
+
+void game::Memory::Exit()
+{
+  orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, &Memory::OnEvent);
+  orxCommand_Unregister("Memory.Report");
+
+  Update();
+  Report();
+}
+
+void game::Memory::Update()
+{
+  orxU64 sizes[static_cast<size_t>(Subsystem::Count)]{};
+
+  orxBundle_GetMemoryUsage(&bundle);
+  sizes[static_cast<size_t>(Subsystem::Bundle)] = bundle.u64Size;
+  sizes[static_cast<size_t>(Subsystem::BundleScratch)] = bundle.u64ScratchSize;
+
+  // Reserved rather than used: banks grow by whole segments and never shrink
+  orxU32 binders;
+  orxU64 used, reserved;
+  ScrollObjectBinderBase::GetBankUsage(binders, used, reserved);
+  sizes[static_cast<size_t>(Subsystem::ScrollBanks)] = reserved;
+
+  for (auto texture = orxTEXTURE(orxStructure_GetFirst(orxSTRUCTURE_ID_TEXTURE)); texture; texture = orxTEXTURE(orxStructure_GetNext(texture)))
+  {
+    sizes[static_cast<size_t>(Subsystem::Textures)] += GetTextureSize(texture);
+  }
+
+  sizes[static_cast<size_t>(Subsystem::Sounds)] = GetSoundsSize();
+
+  for (size_t i = 0; i < static_cast<size_t>(Subsystem::Count); i++)
+  {
+    auto &usage = usages[i];
+    usage.size = sizes[i];
+    usage.peak = std::max(usage.peak, usage.size);
+    if (static_cast<Subsystem>(i) == Subsystem::Bundle)
+    {
+      // Also catches buffers released between samples
+      usage.peak = std::max(usage.peak, bundle.u64PeakSize);
+    }
+
+    const auto over = usage.budget != 0 && usage.size > usage.budget;
+    if (over && !usage.over)
+    {
+      orxLOG("[MEMORY] %s over budget: %.1f KB / %.1f KB.", infos[i].name, ToKB(usage.size), ToKB(usage.budget));
+      LogOffenders(static_cast<Subsystem>(i));
+    }
+    usage.over = over;
+  }
+}
+
+orxU64 game::Memory::GetSize(Subsystem subsystem) const
+{
+  return usages[static_cast<size_t>(subsystem)].size;
+}
+
+orxU64 game::Memory::GetPeakSize(Subsystem subsystem) const
+{
+  return usages[static_cast<size_t>(subsystem)].peak;
+}
+
+void game::Memory::Report() const
+{
+  orxLOG("[MEMORY] %-16s %12s %12s %12s", "Subsystem", "Size(KB)", "Peak(KB)", "Budget(KB)");
+  for (size_t i = 0; i < static_cast<size_t>(Subsystem::Count); i++)
+  {
+    const auto &usage = usages[i];
+    orxLOG("[MEMORY] %-16s %12.1f %12.1f %12.1f%s", infos[i].name, ToKB(usage.size), ToKB(usage.peak), ToKB(usage.budget), usage.over ? " OVER" : "");
+  }
+
+  // Growth events show which binders need more reserved
+  ScrollObjectBinderBase::LogBankUsage();
+}
+
+orxSTATUS orxFASTCALL game::Memory::OnEvent(const orxEVENT *_pstEvent)
+{
+  auto &memory = Get();
+  const auto now = orxSystem_GetTime();
+  if (now >= memory.nextCheck)
+  {
+    memory.Update();
+    memory.nextCheck = now + memory.checkPeriod;
+  }
+  return orxSTATUS_SUCCESS;
+}
+
+void game::Memory::LogOffenders(Subsystem subsystem) const
+{
+  std::vector<std::pair<orxU64, const orxSTRING>> offenders;
+
+  switch (subsystem)
+  {
+  case Subsystem::Bundle:
+  {
+    // Buffers held aren't tracked individually, only the largest ever read, which may be released since
+    orxLOG("[MEMORY]   Largest resource read so far: %s: %.1f KB", bundle.zLargestName, ToKB(bundle.u64LargestSize));
+    break;
+  }
+
+  case Subsystem::BundleScratch:
+  {
+    // Scratch buffers only grow until exit, so the largest compressed read is still held
+    orxLOG("[MEMORY]   Largest scratch buffer: %.1f KB", ToKB(bundle.u64IntermediatePeakSize));
+    break;
+  }
+
+  case Subsystem::ScrollBanks:
+  {
+    // Live objects per model
+    auto &game = planet::GetInstance();
+    std::map<const orxSTRING, orxU64> counts;
+    for (auto object = game.GetNextObject(); object; object = game.GetNextObject(object))
+    {
+      counts[object->GetModelName()]++;
+    }
+    for (const auto &[model, count] : counts)
+    {
+      offenders.push_back({count, model});
+    }
+    break;
+  }
+
+  case Subsystem::Textures:
+  {
+    for (auto texture = orxTEXTURE(orxStructure_GetFirst(orxSTRUCTURE_ID_TEXTURE)); texture; texture = orxTEXTURE(orxStructure_GetNext(texture)))
+    {
+      offenders.push_back({GetTextureSize(texture), orxTexture_GetName(texture)});
+    }
+    break;
+  }
+
+  case Subsystem::Sounds:
+  {
+    for (auto sound = orxSOUND(orxStructure_GetFirst(orxSTRUCTURE_ID_SOUND)); sound; sound = orxSOUND(orxStructure_GetNext(sound)))
+    {
+      if (!orxSound_IsStream(sound))
+      {
+        offenders.push_back({static_cast<orxU64>(orxSound_GetDuration(sound) * soundBytesPerSecond), orxSound_GetName(sound)});
+      }
+    }
+    break;
+  }
+
+  default:
+    break;
+  }
+
+  const auto count = std::min(offenders.size(), offenderCount);
+  std::partial_sort(offenders.begin(), offenders.begin() + count, offenders.end(), [](const auto &a, const auto &b)
+                    { return a.first > b.first; });
+  for (size_t i = 0; i < count; i++)
+  {
+    if (subsystem == Subsystem::ScrollBanks)
+    {
+      orxLOG("[MEMORY]   %s: %llu objects", offenders[i].second, offenders[i].first);
+    }
+    else
+    {
+      orxLOG("[MEMORY]   %s: %.1f KB", offenders[i].second, ToKB(offenders[i].first));
+    }
+  }
+}
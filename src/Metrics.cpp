@@ -0,0 +1,401 @@
+/**
+ * @file Metrics.cpp
+ * @date 19-Oct-2026
+ */
+
+#include <algorithm>
+
+#include "Extensions.h"
+#include "Metrics.h"
+#include "Object.h"
+#include "Particles.h"
+
+namespace
+{
+  /// @brief Count all Scroll objects
+  orxDOUBLE CountObjects()
+  {
+    auto &game = planet::GetInstance();
+    orxU32 count = 0;
+    for (auto object = game.GetNextObject(); object; object = game.GetNextObject(object))
+    {
+      count++;
+    }
+    return count;
+  }
+
+  /// @brief Count the objects bound to a given class
+  template <typename O>
+  orxDOUBLE CountObjects()
+  {
+    auto &game = planet::GetInstance();
+    orxU32 count = 0;
+    for (auto object = game.GetNextObject<O>(); object; object = game.GetNextObject<O>(object))
+    {
+      count++;
+    }
+    return count;
+  }
+
+  const orxSTRING GetDumpPath(const orxSTRING path)
+  {
+    if (path == orxNULL || *path == orxCHAR_NULL)
+    {
+      orxConfig_PushSection("Metrics");
+      path = orxConfig_GetString("DumpFile");
+      orxConfig_PopSection();
+    }
+    return path;
+  }
+
+  bool IsJson(const orxSTRING path)
+  {
+    const auto length = orxString_GetLength(path);
+    return length >= 5 && orxString_ICompare(path + length - 5, ".json") == 0;
+  }
+
+  /// Metrics.Show [Show]
+  void orxFASTCALL CommandShow(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    auto &metrics = game::Metrics::Get();
+    metrics.Show((_u32ArgNumber > 0) ? (_astArgList[0].bValue != orxFALSE) : !metrics.IsShown());
+    _pstResult->bValue = metrics.IsShown() ? orxTRUE : orxFALSE;
+  }
+
+  /// Metrics.Dump [Path]
+  void orxFASTCALL CommandDump(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    _pstResult->bValue = game::Metrics::Get().Dump((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL) ? orxTRUE : orxFALSE;
+  }
+}
+
+game::Metrics &game::Metrics::Get()
+{
+  static Metrics instance;
+  return instance;
+}
+
+void game::Metrics::Init()
+{
+  static const orxCOMMAND_VAR_DEF result = {"Success", orxCOMMAND_VAR_TYPE_BOOL};
+  static const orxCOMMAND_VAR_DEF showParams[] = {{"Show = toggle", orxCOMMAND_VAR_TYPE_BOOL}};
+  static const orxCOMMAND_VAR_DEF dumpParams[] = {{"Path = Metrics.DumpFile", orxCOMMAND_VAR_TYPE_STRING}};
+
+  orxCommand_Register("Metrics.Show", &CommandShow, 0, 1, showParams, &result);
+  orxCommand_Register("Metrics.Dump", &CommandDump, 0, 1, dumpParams, &result);
+
+  // Built-in metrics, registered up front so dumps have stable columns
+  created = AddCounter("ObjectsCreated");
+  AddCounter("ObjectsDeleted");
+  merges = AddCounter("Merges");
+  bundleOpened = AddCounter("BundleOpened");
+  bundleClosed = AddCounter("BundleClosed");
+
+  AddGauge("ScrollObjects", []()
+           { return CountObjects(); });
+  AddGauge("Planets", &CountObjects<Planet>);
+  AddGauge("Bodies", []()
+           { return static_cast<orxDOUBLE>(orxStructure_GetCount(orxSTRUCTURE_ID_BODY)); });
+  AddGauge("Sounds", []()
+           { return static_cast<orxDOUBLE>(orxStructure_GetCount(orxSTRUCTURE_ID_SOUND)); });
+  AddGauge("Particles", []()
+           { return static_cast<orxDOUBLE>(Particles::Get().GetCount()); });
+  AddGauge("BundleResources", [this]()
+           { return static_cast<orxDOUBLE>(bundleOpenCount - bundleCloseCount); });
+  AddGauge("FrameMemory", []()
+           { return static_cast<orxDOUBLE>(planet::GetInstance().GetFrameMemoryStats().u32Size); });
+  AddGauge("FrameMemoryPeak", []()
+           { return static_cast<orxDOUBLE>(planet::GetInstance().GetFrameMemoryStats().u32PeakSize); });
+
+  frameTime = AddHistogram("FrameMs", {4.0, 8.0, 16.7, 33.3, 50.0, 100.0});
+  createdPerFrame = AddHistogram("CreatedPerFrame", {0.0, 1.0, 2.0, 4.0, 8.0, 16.0, 32.0});
+  mergesPerFrame = AddHistogram("MergesPerFrame", {0.0, 1.0, 2.0, 4.0, 8.0});
+
+  orxConfig_PushSection("Metrics");
+  overlayPeriod = orxConfig_GetFloat("OverlayPeriod");
+  dumpPeriod = orxConfig_GetFloat("DumpPeriod");
+  const auto dumpPath = orxString_Store(orxConfig_GetString("DumpFile"));
+  const auto showOverlay = orxConfig_GetBool("ShowOverlay");
+  orxConfig_PopSection();
+
+  startTime = frameStart = orxSystem_GetTime();
+
+  // Periodic dumps for soak tests
+  if (dumpPeriod > orxFLOAT_0 && *dumpPath != orxCHAR_NULL)
+  {
+    dumpFile = orxFile_Open(dumpPath, orxFILE_KU32_FLAG_OPEN_WRITE);
+    if (dumpFile != orxNULL)
+    {
+      dumpJson = IsJson(dumpPath);
+      WriteHeader(dumpFile, dumpJson);
+      nextDump = startTime + dumpPeriod;
+    }
+    else
+    {
+      orxLOG("[METRICS] Can't open <%s> for writing.", dumpPath);
+    }
+  }
+
+  orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, &Metrics::OnEvent);
+  orxEvent_SetHandlerIDFlags(&Metrics::OnEvent, orxEVENT_TYPE_SYSTEM, orxNULL, orxEVENT_GET_FLAG(orxSYSTEM_EVENT_GAME_LOOP_STOP), orxEVENT_KU32_MASK_ID_ALL);
+
+  Show(showOverlay != orxFALSE);
+}
+
+void game::Metrics::Exit()
+{
+  orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, &Metrics::OnEvent);
+
+  orxCommand_Unregister("Metrics.Show");
+  orxCommand_Unregister("Metrics.Dump");
+
+  if (dumpFile != orxNULL)
+  {
+    WriteRow(dumpFile, dumpJson);
+    orxFile_Close(dumpFile);
+    dumpFile = orxNULL;
+  }
+
+  // Metrics stay registered: call sites keep their IDs
+  overlay = orxNULL;
+}
+
+game::Metrics::Id game::Metrics::AddCounter(const orxSTRING name)
+{
+  const auto found = std::find_if(counters.begin(), counters.end(), [name](const Counter &counter)
+                                  { return orxString_Compare(counter.name, name) == 0; });
+  if (found != counters.end())
+  {
+    return static_cast<Id>(found - counters.begin());
+  }
+
+  counters.push_back({orxString_Store(name)});
+  return static_cast<Id>(counters.size() - 1);
+}
+
+game::Metrics::Id game::Metrics::AddGauge(const orxSTRING name, std::function<orxDOUBLE()> sample)
+{
+  const auto found = std::find_if(gauges.begin(), gauges.end(), [name](const Gauge &gauge)
+                                  { return orxString_Compare(gauge.name, name) == 0; });
+  if (found != gauges.end())
+  {
+    return static_cast<Id>(found - gauges.begin());
+  }
+
+  gauges.push_back({orxString_Store(name), std::move(sample)});
+  return static_cast<Id>(gauges.size() - 1);
+}
+
+game::Metrics::Id game::Metrics::AddHistogram(const orxSTRING name, std::vector<orxDOUBLE> bounds)
+{
+  const auto found = std::find_if(histograms.begin(), histograms.end(), [name](const Histogram &histogram)
+                                  { return orxString_Compare(histogram.name, name) == 0; });
+  if (found != histograms.end())
+  {
+    return static_cast<Id>(found - histograms.begin());
+  }
+
+  Histogram histogram{orxString_Store(name), std::move(bounds)};
+  histogram.buckets.resize(histogram.bounds.size() + 1);
+  histograms.push_back(std::move(histogram));
+  return static_cast<Id>(histograms.size() - 1);
+}
+
+void game::Metrics::Increment(Id counter, orxU32 amount)
+{
+  auto &entry = counters[counter];
+  entry.total += amount;
+  entry.frame += amount;
+}
+
+void game::Metrics::Observe(Id histogram, orxDOUBLE value)
+{
+  auto &entry = histograms[histogram];
+  const auto bucket = std::lower_bound(entry.bounds.begin(), entry.bounds.end(), value) - entry.bounds.begin();
+  entry.buckets[bucket]++;
+  entry.count++;
+  entry.sum += value;
+  entry.max = std::max(entry.max, value);
+}
+
+void game::Metrics::Show(bool show)
+{
+  if (show && overlay == orxNULL)
+  {
+    overlay = orxObject_CreateFromConfig("MetricsOverlay");
+    nextOverlay = 0.0;
+  }
+  else if (!show && overlay != orxNULL)
+  {
+    orxObject_Delete(overlay);
+    overlay = orxNULL;
+  }
+}
+
+bool game::Metrics::IsShown() const
+{
+  return overlay != orxNULL;
+}
+
+bool game::Metrics::Dump(const orxSTRING path) const
+{
+  path = GetDumpPath(path);
+
+  auto file = orxFile_Open(path, orxFILE_KU32_FLAG_OPEN_WRITE);
+  if (file == orxNULL)
+  {
+    orxLOG("[METRICS] Can't open <%s> for writing.", path);
+    return false;
+  }
+
+  const auto json = IsJson(path);
+  WriteHeader(file, json);
+  WriteRow(file, json);
+  orxFile_Close(file);
+
+  orxLOG("[METRICS] Dumped to <%s>.", path);
+  return true;
+}
+
+orxSTATUS orxFASTCALL game::Metrics::OnEvent(const orxEVENT *_pstEvent)
+{
+  Get().EndFrame();
+  return orxSTATUS_SUCCESS;
+}
+
+void game::Metrics::EndFrame()
+{
+  const auto now = orxSystem_GetTime();
+
+  // Bundled resources opened & closed this frame
+  orxU32 openCount, closeCount;
+  orxBundle_GetResourceCounts(&openCount, &closeCount);
+  Increment(bundleOpened, openCount - bundleOpenCount);
+  Increment(bundleClosed, closeCount - bundleCloseCount);
+  bundleOpenCount = openCount;
+  bundleCloseCount = closeCount;
+
+  Observe(frameTime, (now - frameStart) * 1000.0);
+  Observe(createdPerFrame, counters[created].frame);
+  Observe(mergesPerFrame, counters[merges].frame);
+  frameStart = now;
+
+  for (auto &counter : counters)
+  {
+    counter.last = counter.frame;
+    counter.frame = 0;
+  }
+
+  if (overlay != orxNULL && now >= nextOverlay)
+  {
+    UpdateOverlay();
+    nextOverlay = now + overlayPeriod;
+  }
+
+  if (dumpFile != orxNULL && now >= nextDump)
+  {
+    WriteRow(dumpFile, dumpJson);
+    nextDump = now + dumpPeriod;
+  }
+}
+
+void game::Metrics::UpdateOverlay() const
+{
+  // Transient, the text gets copied by the overlay
+  constexpr orxU32 lineSize = 128;
+  const auto size = static_cast<orxU32>(counters.size() + gauges.size() + histograms.size()) * lineSize + 1;
+  auto text = planet::GetInstance().AllocateFrameArray<orxCHAR>(size);
+  auto cursor = text;
+  *cursor = orxCHAR_NULL;
+
+  for (const auto &counter : counters)
+  {
+    cursor += orxString_NPrint(cursor, lineSize, "%-16s %8llu  +%u\n", counter.name, (unsigned long long)counter.total, counter.last);
+  }
+  for (const auto &gauge : gauges)
+  {
+    cursor += orxString_NPrint(cursor, lineSize, "%-16s %8.0f\n", gauge.name, gauge.sample());
+  }
+  for (const auto &histogram : histograms)
+  {
+    cursor += orxString_NPrint(cursor, lineSize, "%-16s avg %6.2f  max %6.2f\n", histogram.name, (histogram.count > 0) ? histogram.sum / histogram.count : 0.0, histogram.max);
+  }
+
+  orxObject_SetTextString(overlay, text);
+}
+
+void game::Metrics::WriteHeader(orxFILE *file, bool json) const
+{
+  // JSON lines are self-describing
+  if (json)
+  {
+    return;
+  }
+
+  orxFile_Print(file, "Time");
+  for (const auto &counter : counters)
+  {
+    orxFile_Print(file, ",%s", counter.name);
+  }
+  for (const auto &gauge : gauges)
+  {
+    orxFile_Print(file, ",%s", gauge.name);
+  }
+  for (const auto &histogram : histograms)
+  {
+    orxFile_Print(file, ",%s.Count,%s.Avg,%s.Max", histogram.name, histogram.name, histogram.name);
+  }
+  orxFile_Print(file, "\n");
+}
+
+void game::Metrics::WriteRow(orxFILE *file, bool json) const
+{
+  const auto time = orxSystem_GetTime() - startTime;
+
+  if (!json)
+  {
+    orxFile_Print(file, "%.3f", time);
+    for (const auto &counter : counters)
+    {
+      orxFile_Print(file, ",%llu", (unsigned long long)counter.total);
+    }
+    for (const auto &gauge : gauges)
+    {
+      orxFile_Print(file, ",%g", gauge.sample());
+    }
+    for (const auto &histogram : histograms)
+    {
+      orxFile_Print(file, ",%u,%.3f,%.3f", histogram.count, (histogram.count > 0) ? histogram.sum / histogram.count : 0.0, histogram.max);
+    }
+    orxFile_Print(file, "\n");
+    return;
+  }
+
+  orxFile_Print(file, "{\"time\":%.3f,\"counters\":{", time);
+  for (size_t i = 0; i < counters.size(); i++)
+  {
+    orxFile_Print(file, "%s\"%s\":%llu", (i > 0) ? "," : "", counters[i].name, (unsigned long long)counters[i].total);
+  }
+  orxFile_Print(file, "},\"gauges\":{");
+  for (size_t i = 0; i < gauges.size(); i++)
+  {
+    orxFile_Print(file, "%s\"%s\":%g", (i > 0) ? "," : "", gauges[i].name, gauges[i].sample());
+  }
+  orxFile_Print(file, "},\"histograms\":{");
+  for (size_t i = 0; i < histograms.size(); i++)
+  {
+    const auto &histogram = histograms[i];
+    orxFile_Print(file, "%s\"%s\":{\"count\":%u,\"avg\":%.3f,\"max\":%.3f,\"bounds\":[", (i > 0) ? "," : "", histogram.name, histogram.count, (histogram.count > 0) ? histogram.sum / histogram.count : 0.0, histogram.max);
+    for (size_t j = 0; j < histogram.bounds.size(); j++)
+    {
+      orxFile_Print(file, "%s%g", (j > 0) ? "," : "", histogram.bounds[j]);
+    }
+    orxFile_Print(file, "],\"buckets\":[");
+    for (size_t j = 0; j < histogram.buckets.size(); j++)
+    {
+      orxFile_Print(file, "%s%u", (j > 0) ? "," : "", histogram.buckets[j]);
+    }
+    orxFile_Print(file, "]}");
+  }
+  orxFile_Print(file, "}}\n");
+}
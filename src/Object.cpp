@@ -5,7 +5,13 @@
 
 #include <map>
 
+#include "Metrics.h"
 #include "Object.h"
+#include "Profiler.h"
+#include "Random.h"
+#include "Replay.h"
+#include "TextCache.h"
+#include "Voices.h"
 
 // General game functionality
 
@@ -46,6 +52,63 @@ namespace
 
     return EqualContent(a->GetModelName(), b->GetModelName());
   }
+
+  /// @brief Send an event signaling the Game Over state to the current scene
+  void FireGameOver()
+  {
+    orxConfig_PushSection("Runtime");
+    auto scene = orxOBJECT(orxStructure_Get(orxConfig_GetU64("Scene")));
+    orxConfig_PopSection();
+    orxASSERT(scene != orxNULL);
+    orxObject_FireTriggerRecursive(scene, "GameOver", orxNULL, 0);
+  }
+}
+
+// Background
+
+void game::Background::OnCreate()
+{
+  Object::OnCreate();
+
+  PushConfigSection();
+  const auto choice = Random::Get().PickListString(Random::Stream::Cosmetic, "Choices");
+  const auto hasAlpha = orxConfig_HasValue("Alpha");
+  PopConfigSection();
+
+  if (*choice == orxCHAR_NULL)
+  {
+    return;
+  }
+
+  // Attached like a ChildList entry
+  auto child = orxObject_CreateFromConfig(choice);
+  if (child == orxNULL)
+  {
+    return;
+  }
+  orxObject_SetOwner(child, GetOrxObject());
+  orxObject_SetParent(child, GetOrxObject());
+
+  if (hasAlpha)
+  {
+    orxObject_SetAlpha(child, orxObject_GetAlpha(GetOrxObject()));
+  }
+}
+
+// Game scene
+
+void game::GameScene::OnCreate()
+{
+  Object::OnCreate();
+
+  Replay::Get().StartSession();
+}
+
+void game::GameScene::OnDelete()
+{
+  Replay::Get().StopSession();
+
+  Object::OnDelete();
 }
 
 void game::Planet::OnCreate()
@@ -60,18 +123,15 @@ void game::Planet::OnDelete()
 
 void game::Planet::Update(const orxCLOCK_INFO &_rstInfo)
 {
+  PROFILE_MODEL(*this, Update);
+
   // Add time if we're in contact with the arena top
   if (touchingArenaTop.has_value())
   {
     touchingArenaTop = *touchingArenaTop + _rstInfo.fDT;
     if (*touchingArenaTop > 2.0)
     {
-      // Send an event signaling the Game Over state
-      orxConfig_PushSection("Runtime");
-      auto scene = orxOBJECT(orxStructure_Get(orxConfig_GetU64("Scene")));
-      orxConfig_PopSection();
-      orxASSERT(scene != orxNULL);
-      orxObject_FireTriggerRecursive(scene, "GameOver", orxNULL, 0);
+      FireGameOver();
 
       // Reset the timer so that we don't fire the event every frame
       touchingArenaTop.reset();
@@ -83,6 +143,9 @@ void game::Planet::Update(const orxCLOCK_INFO &_rstInfo)
 
 void game::Planet::OnCollide(ScrollObject *_poCollider, orxBODY_PART *_pstPart, orxBODY_PART *_pstColliderPart, const orxVECTOR &_rvPosition, const orxVECTOR &_rvNormal)
 {
+  PROFILE_SCOPE("Planet_OnCollide");
+  PROFILE_MODEL(*this, Collide);
+
   if (EqualModelName(this, _poCollider))
   {
     OnPlanetCollide(_poCollider);
@@ -104,6 +167,8 @@ void game::Planet::OnSeparate(ScrollObject *_poCollider, orxBODY_PART *_pstPart,
 
 void game::Planet::OnPlanetCollide(ScrollObject *_poCollider)
 {
+  PROFILE_SCOPE("Planet_OnPlanetCollide");
+
   PushConfigSection();
   auto stay = orxConfig_GetBool("Stay");
   auto hasNext = orxConfig_HasValue("Next");
@@ -126,9 +191,11 @@ void game::Planet::OnPlanetCollide(ScrollObject *_poCollider)
     auto planet = orxObject_CreateFromConfig(nextPlanet);
     orxObject_SetWorldPosition(planet, &pos);
 
-    // Create a sound at the location of the new planet
-    auto popSound = orxObject_CreateFromConfig("PopSound");
-    orxObject_SetWorldPosition(popSound, &pos);
+    static const auto merges = Metrics::Get().AddCounter("Merges");
+    Metrics::Get().Increment(merges);
+
+    // Pop! Cascades reuse a few voices rather than piling up new sounds
+    Voices::Get().Play("PopSound");
 
     // Adjust score
     orxConfig_PushSection(nextPlanet);
@@ -145,8 +212,11 @@ void game::Planet::OnPlanetCollide(ScrollObject *_poCollider)
 
 void game::Planet::OnArenaTopCollide()
 {
-  // Start counting time in contact
-  touchingArenaTop = 0.0f;
+  // Start counting time in contact, unless already counting (eg. restored from a snapshot)
+  if (!touchingArenaTop.has_value())
+  {
+    touchingArenaTop = 0.0f;
+  }
 }
 
 void game::Planet::OnArenaTopSeparate()
@@ -155,6 +225,18 @@ void game::Planet::OnArenaTopSeparate()
   touchingArenaTop.reset();
 }
 
+game::Planet::State game::Planet::GetState() const
+{
+  State state;
+  state.touchingArenaTop = touchingArenaTop;
+  return state;
+}
+
+void game::Planet::SetState(const State &state)
+{
+  touchingArenaTop = state.touchingArenaTop;
+}
+
 void game::Dropper::OnCreate()
 {
   Object::OnCreate();
@@ -165,7 +247,7 @@ void game::Dropper::OnDelete()
   Object::OnDelete();
 }
 
-void game::Dropper::UpdatePosition(const orxCLOCK_INFO &_rstInfo)
+void game::Dropper::UpdatePosition(const orxCLOCK_INFO &_rstInfo, orxFLOAT xDirection)
 {
   // Movement specs from config
   PushConfigSection();
@@ -180,7 +262,6 @@ void game::Dropper::UpdatePosition(const orxCLOCK_INFO &_rstInfo)
   GetPosition(position);
 
   // User controls
-  auto xDirection = orxInput_GetValue("Right") - orxInput_GetValue("Left");
   orxVector_Mulf(&speed, &speed, xDirection);
   orxVector_Add(&position, &position, orxVector_Mulf(&speed, &speed, _rstInfo.fDT));
 
@@ -220,15 +301,30 @@ void game::Dropper::DropPlanet()
 
 void game::Dropper::Update(const orxCLOCK_INFO &_rstInfo)
 {
+  PROFILE_SCOPE("Dropper_Update");
+  PROFILE_MODEL(*this, Update);
+
   PushConfigSection();
   const auto minDropWaitTime = orxConfig_GetFloat("MinDropWait");
   PopConfigSection();
 
+  // User controls for this update, live or replayed
+  const auto input = Replay::Get().SampleInput();
+
   // Dropper movement and position bounds
-  UpdatePosition(_rstInfo);
+  UpdatePosition(_rstInfo, input.right - input.left);
 
-  // Drop current planet if we have one
-  if (latest && orxInput_HasBeenActivated("Drop"))
+  // The input set is disabled during playback so the config's OnInput
+  // trigger for GameOver can't fire, replay it from here instead
+  if (Replay::Get().IsPlaying() && input.gameOver)
+  {
+    FireGameOver();
+  }
+
+  // Drop current planet if we have one, presses are latched per frame by the
+  // sampler so one is neither missed nor repeated when fixed-step updates run
+  // 0 or N times in a frame
+  if (latest && input.drop)
   {
     DropPlanet();
   }
@@ -242,26 +338,104 @@ void game::Dropper::Update(const orxCLOCK_INFO &_rstInfo)
     {
       first = false;
       dtSinceDrop = 0.0;
-      CreatePlanet();
+
+      PushConfigSection();
+      const auto name = Replay::Get().ChooseDrop();
+      PopConfigSection();
+
+      CreatePlanet(name);
     }
   }
 
   Object::Update(_rstInfo);
 }
 
-void game::Dropper::CreatePlanet()
+void game::Dropper::CreatePlanet(const orxSTRING name)
 {
   orxASSERT(latest == orxNULL);
 
   orxVECTOR position = orxVECTOR_0;
   GetPosition(position, orxTRUE);
 
-  PushConfigSection();
-  latest = orxObject_CreateFromConfig(orxConfig_GetString("Drop"));
-  PopConfigSection();
+  latest = orxObject_CreateFromConfig(name);
 
   // Remove physics body so we can safely set this as a child object
   orxObject_UnlinkStructure(latest, orxSTRUCTURE_ID_BODY);
 
   orxObject_SetParent(latest, GetOrxObject());
 }
+
+game::Dropper::State game::Dropper::GetState() const
+{
+  State state;
+
+  orxVECTOR position = orxVECTOR_0;
+  GetPosition(position);
+  state.x = position.fX;
+  state.dtSinceDrop = dtSinceDrop;
+  state.first = first;
+  if (latest)
+  {
+    state.held = orxObject_GetName(latest);
+  }
+
+  return state;
+}
+
+void game::Dropper::SetState(const State &state)
+{
+  orxVECTOR position = orxVECTOR_0;
+  GetPosition(position);
+  position.fX = state.x;
+  SetPosition(position);
+
+  dtSinceDrop = state.dtSinceDrop;
+  first = state.first;
+
+  // Swap the held planet for the saved one
+  if (latest)
+  {
+    orxObject_Delete(latest);
+    latest = orxNULL;
+  }
+  if (*state.held != orxCHAR_NULL)
+  {
+    CreatePlanet(state.held);
+  }
+}
+
+void game::Score::OnCreate()
+{
+  Object::OnCreate();
+
+  PushConfigSection();
+  orxConfig_PushSection(orxConfig_GetString("Graphic"));
+  font = orxString_Store(orxConfig_GetString("Font"));
+  orxConfig_PopSection();
+  PopConfigSection();
+}
+
+void game::Score::Update(const orxCLOCK_INFO &_rstInfo)
+{
+  PROFILE_MODEL(*this, Update);
+
+  Object::Update(_rstInfo);
+
+  orxConfig_PushSection("Runtime");
+  const orxU32 score = orxConfig_GetU32("Score");
+  orxConfig_PopSection();
+
+  // Unchanged score, nothing to lay out
+  if (shown == score)
+  {
+    return;
+  }
+  shown = score;
+
+  PushConfigSection();
+  orxCHAR string[64];
+  orxString_NPrint(string, sizeof(string), orxConfig_GetString("Format"), score);
+  PopConfigSection();
+
+  TextCache::Get().SetText(GetOrxObject(), font, string);
+}
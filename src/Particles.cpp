@@ -0,0 +1,371 @@
+/**
+ * @file Particles.cpp
+ * @date 19-Oct-2026
+ */
+
+#include "Particles.h"
+#include "Profiler.h"
+#include "Random.h"
+
+namespace
+{
+  /// Quads per draw call, limited by 16-bit indices
+  constexpr size_t maxBatchSize = 0x10000 / 4;
+
+  /// Scratch section used to resolve color names
+  constexpr const orxCHAR *colorSection = "ParticleColor";
+
+  /// @brief Parse a float or vector value
+  bool ParseValue(const orxSTRING text, orxVECTOR &value, const orxSTRING *remaining)
+  {
+    text = orxString_SkipWhiteSpaces(text);
+    if (orxString_ToVector(text, &value, remaining) != orxSTATUS_FAILURE)
+    {
+      return true;
+    }
+    orxVector_Copy(&value, &orxVECTOR_0);
+    return orxString_ToFloat(text, &value.fX, remaining) != orxSTATUS_FAILURE;
+  }
+
+  orxVECTOR Scalar(orxFLOAT value)
+  {
+    orxVECTOR result;
+    orxVector_Set(&result, value, orxFLOAT_0, orxFLOAT_0);
+    return result;
+  }
+
+  /// Particles.Emit Emitter Position
+  void orxFASTCALL CommandEmit(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    game::Particles::Get().Emit(_astArgList[0].zValue, _astArgList[1].vValue);
+    _pstResult->zValue = _astArgList[0].zValue;
+  }
+}
+
+game::Particles::Range game::Particles::ReadRange(const orxSTRING key, const orxVECTOR &fallback)
+{
+  Range range{fallback, fallback};
+
+  const orxSTRING remaining = orxNULL;
+  if (orxConfig_HasValue(key) && ParseValue(orxConfig_GetListString(key, 0), range.min, &remaining))
+  {
+    range.max = range.min;
+    if (remaining != orxNULL && *(remaining = orxString_SkipWhiteSpaces(remaining)) == '~')
+    {
+      ParseValue(remaining + 1, range.max, orxNULL);
+    }
+  }
+  return range;
+}
+
+game::Particles &game::Particles::Get()
+{
+  static Particles instance;
+  return instance;
+}
+
+void game::Particles::Init()
+{
+  static const orxCOMMAND_VAR_DEF result = {"Emitter", orxCOMMAND_VAR_TYPE_STRING};
+  static const orxCOMMAND_VAR_DEF params[] = {{"Emitter", orxCOMMAND_VAR_TYPE_STRING}, {"Position", orxCOMMAND_VAR_TYPE_VECTOR}};
+
+  orxCommand_Register("Particles.Emit", &CommandEmit, 2, 0, params, &result);
+
+  // Quad indices never change, they're shared by all batches
+  indices.resize(maxBatchSize * 6);
+  for (size_t quad = 0; quad < maxBatchSize; quad++)
+  {
+    const auto vertex = static_cast<orxU16>(quad * 4);
+    const auto index = &indices[quad * 6];
+    index[0] = vertex;
+    index[1] = vertex + 1;
+    index[2] = vertex + 2;
+    index[3] = vertex + 2;
+    index[4] = vertex + 1;
+    index[5] = vertex + 3;
+  }
+
+  orxConfig_PushSection("ParticleField");
+  const auto capacity = static_cast<size_t>(orxConfig_GetU32("Capacity"));
+  orxConfig_PopSection();
+  for (auto array : {&x, &y, &vx, &vy, &rotation, &angularVelocity, &halfWidth, &halfHeight, &timeLeft})
+  {
+    array->reserve(capacity);
+  }
+  color.reserve(capacity);
+  texture.reserve(capacity);
+  vertices.reserve(capacity * 4);
+}
+
+void game::Particles::Exit()
+{
+  Clear();
+
+  orxCommand_Unregister("Particles.Emit");
+}
+
+const game::Particles::Emitter &game::Particles::GetEmitter(const orxSTRING name)
+{
+  const auto id = orxString_GetID(name);
+  const auto found = emitters.find(id);
+  if (found != emitters.end())
+  {
+    return found->second;
+  }
+
+  Emitter emitter;
+
+  orxConfig_PushSection(name);
+  emitter.count = orxConfig_GetU32("Count");
+  const auto particle = orxConfig_GetString("Particle");
+  orxConfig_PopSection();
+
+  orxConfig_PushSection(particle);
+  emitter.size = ReadRange("Size", orxVECTOR_1);
+  emitter.rotation = ReadRange("Rotation", orxVECTOR_0);
+  emitter.angularVelocity = ReadRange("AngularVelocity", orxVECTOR_0);
+  emitter.speed = ReadRange("Speed", orxVECTOR_0);
+  emitter.alpha = ReadRange("Alpha", Scalar(orxFLOAT_1));
+  emitter.lifeTime = ReadRange("LifeTime", Scalar(orxFLOAT_1));
+  emitter.relativeSpeed = orxConfig_GetBool("UseRelativeSpeed");
+
+  // Color names are resolved by orx, through a scratch key
+  const auto colorCount = orxConfig_GetListCount("Color");
+  for (orxS32 i = 0; i < colorCount; i++)
+  {
+    const auto value = orxConfig_GetListString("Color", i);
+    orxVECTOR rgb;
+    orxConfig_PushSection(colorSection);
+    orxConfig_SetString("Color", value);
+    if (orxConfig_GetColorVector("Color", orxCOLORSPACE_COMPONENT, &rgb) != orxNULL)
+    {
+      emitter.colors.push_back(orx2RGBA(static_cast<orxU8>(rgb.fR), static_cast<orxU8>(rgb.fG), static_cast<orxU8>(rgb.fB), 0xFF));
+    }
+    orxConfig_PopSection();
+  }
+  orxConfig_ClearSection(colorSection);
+  if (emitter.colors.empty())
+  {
+    emitter.colors.push_back(orx2RGBA(0xFF, 0xFF, 0xFF, 0xFF));
+  }
+
+  const auto graphic = orxConfig_GetString("Graphic");
+  orxConfig_PopSection();
+
+  orxConfig_PushSection(graphic);
+  emitter.texture = orxTexture_CreateFromFile(orxConfig_GetString("Texture"), orxFALSE);
+  orxConfig_PopSection();
+
+  if (emitter.texture == orxNULL)
+  {
+    orxLOG("[PARTICLES] Emitter <%s>: no texture for particle <%s>, nothing will be emitted.", name, particle);
+  }
+
+  return emitters.emplace(id, std::move(emitter)).first->second;
+}
+
+void game::Particles::Resize(size_t count)
+{
+  for (auto array : {&x, &y, &vx, &vy, &rotation, &angularVelocity, &halfWidth, &halfHeight, &timeLeft})
+  {
+    array->resize(count);
+  }
+  color.resize(count);
+  texture.resize(count);
+}
+
+void game::Particles::Emit(const orxSTRING name, const orxVECTOR &position)
+{
+  const auto &emitter = GetEmitter(name);
+  if (emitter.count == 0 || emitter.texture == orxNULL)
+  {
+    return;
+  }
+
+  auto &random = Random::Get().GetStream(Random::Stream::Cosmetic);
+  const auto first = x.size();
+  Resize(first + emitter.count);
+
+  for (auto i = first; i < x.size(); i++)
+  {
+    const auto angle = random.NextFloat(emitter.rotation.min.fX, emitter.rotation.max.fX) * orxMATH_KF_DEG_TO_RAD;
+    auto speedX = random.NextFloat(emitter.speed.min.fX, emitter.speed.max.fX);
+    auto speedY = random.NextFloat(emitter.speed.min.fY, emitter.speed.max.fY);
+    if (emitter.relativeSpeed)
+    {
+      const auto c = orxMath_Cos(angle);
+      const auto s = orxMath_Sin(angle);
+      const auto localX = speedX;
+      speedX = c * localX - s * speedY;
+      speedY = s * localX + c * speedY;
+    }
+
+    x[i] = position.fX;
+    y[i] = position.fY;
+    vx[i] = speedX;
+    vy[i] = speedY;
+    rotation[i] = angle;
+    angularVelocity[i] = random.NextFloat(emitter.angularVelocity.min.fX, emitter.angularVelocity.max.fX) * orxMATH_KF_DEG_TO_RAD;
+    halfWidth[i] = random.NextFloat(emitter.size.min.fX, emitter.size.max.fX) * orx2F(0.5f);
+    halfHeight[i] = random.NextFloat(emitter.size.min.fY, emitter.size.max.fY) * orx2F(0.5f);
+    timeLeft[i] = random.NextFloat(emitter.lifeTime.min.fX, emitter.lifeTime.max.fX);
+    color[i] = emitter.colors[random.NextIndex(static_cast<orxU32>(emitter.colors.size()))];
+    color[i].u8A = static_cast<orxU8>(orxCLAMP(random.NextFloat(emitter.alpha.min.fX, emitter.alpha.max.fX), orxFLOAT_0, orxFLOAT_1) * 255.0f);
+    texture[i] = emitter.texture;
+  }
+}
+
+void game::Particles::Update(orxFLOAT dt)
+{
+  const auto count = x.size();
+  auto px = x.data(), py = y.data(), pvx = vx.data(), pvy = vy.data();
+  auto pr = rotation.data(), pav = angularVelocity.data(), pt = timeLeft.data();
+
+  // Straight loops over packed arrays, left for the compiler to vectorize
+  for (size_t i = 0; i < count; i++)
+  {
+    px[i] += pvx[i] * dt;
+    py[i] += pvy[i] * dt;
+    pr[i] += pav[i] * dt;
+    pt[i] -= dt;
+  }
+
+  // Compacts the survivors, keeping emission (and draw) order
+  size_t alive = 0;
+  for (size_t i = 0; i < count; i++)
+  {
+    if (pt[i] > orxFLOAT_0)
+    {
+      if (alive != i)
+      {
+        x[alive] = x[i];
+        y[alive] = y[i];
+        vx[alive] = vx[i];
+        vy[alive] = vy[i];
+        rotation[alive] = rotation[i];
+        angularVelocity[alive] = angularVelocity[i];
+        halfWidth[alive] = halfWidth[i];
+        halfHeight[alive] = halfHeight[i];
+        timeLeft[alive] = timeLeft[i];
+        color[alive] = color[i];
+        texture[alive] = texture[i];
+      }
+      alive++;
+    }
+  }
+  if (alive != count)
+  {
+    Resize(alive);
+  }
+}
+
+void game::Particles::Render(const orxDISPLAY_TRANSFORM &transform, const orxVECTOR &origin) const
+{
+  const auto count = x.size();
+  if (count == 0)
+  {
+    return;
+  }
+
+  // World to screen: scale, then rotate around the reference object
+  const auto cameraCos = orxMath_Cos(transform.fRotation);
+  const auto cameraSin = orxMath_Sin(transform.fRotation);
+  const auto ax = cameraCos * transform.fScaleX, bx = -cameraSin * transform.fScaleY;
+  const auto ay = cameraSin * transform.fScaleX, by = cameraCos * transform.fScaleY;
+
+  vertices.resize(count * 4);
+  for (size_t i = 0; i < count; i++)
+  {
+    const auto c = orxMath_Cos(rotation[i]);
+    const auto s = orxMath_Sin(rotation[i]);
+    const auto wx = x[i] - origin.fX;
+    const auto wy = y[i] - origin.fY;
+    const auto hw = halfWidth[i];
+    const auto hh = halfHeight[i];
+    const auto quad = &vertices[i * 4];
+
+    // Corners: top left, top right, bottom left, bottom right
+    const orxFLOAT cornerX[4] = {-hw, hw, -hw, hw};
+    const orxFLOAT cornerY[4] = {-hh, -hh, hh, hh};
+    for (size_t corner = 0; corner < 4; corner++)
+    {
+      const auto px = wx + c * cornerX[corner] - s * cornerY[corner];
+      const auto py = wy + s * cornerX[corner] + c * cornerY[corner];
+      quad[corner].fX = transform.fDstX + ax * px + bx * py;
+      quad[corner].fY = transform.fDstY + ay * px + by * py;
+      quad[corner].fU = (corner & 1) ? orxFLOAT_1 : orxFLOAT_0;
+      quad[corner].fV = (corner & 2) ? orxFLOAT_1 : orxFLOAT_0;
+      quad[corner].stRGBA = color[i];
+    }
+  }
+
+  // One draw per run of particles sharing a texture
+  for (size_t start = 0, end; start < count; start = end)
+  {
+    for (end = start + 1; end < count && end - start < maxBatchSize && texture[end] == texture[start]; end++)
+    {
+    }
+
+    orxDISPLAY_MESH mesh;
+    orxMemory_Zero(&mesh, sizeof(mesh));
+    mesh.astVertexList = &vertices[start * 4];
+    mesh.au16IndexList = indices.data();
+    mesh.u32VertexNumber = static_cast<orxU32>((end - start) * 4);
+    mesh.u32IndexNumber = static_cast<orxU32>((end - start) * 6);
+    mesh.ePrimitive = orxDISPLAY_PRIMITIVE_TRIANGLES;
+    orxDisplay_DrawMesh(&mesh, orxTexture_GetBitmap(texture[start]), orxDISPLAY_SMOOTHING_DEFAULT, orxDISPLAY_BLEND_MODE_ALPHA);
+  }
+}
+
+void game::Particles::Clear()
+{
+  Resize(0);
+
+  for (auto &entry : emitters)
+  {
+    if (entry.second.texture != orxNULL)
+    {
+      orxTexture_Delete(entry.second.texture);
+    }
+  }
+  emitters.clear();
+}
+
+orxU32 game::Particles::GetCount() const
+{
+  return static_cast<orxU32>(x.size());
+}
+
+// Particle field
+
+void game::ParticleField::OnCreate()
+{
+  Object::OnCreate();
+
+  // Picks up config changes from one game to the next
+  Particles::Get().Clear();
+}
+
+void game::ParticleField::OnDelete()
+{
+  Particles::Get().Clear();
+
+  Object::OnDelete();
+}
+
+void game::ParticleField::Update(const orxCLOCK_INFO &_rstInfo)
+{
+  PROFILE_MODEL(*this, Update);
+
+  Particles::Get().Update(_rstInfo.fDT);
+}
+
+orxBOOL game::ParticleField::OnRender(orxRENDER_EVENT_PAYLOAD &_rstPayload)
+{
+  orxVECTOR origin;
+  GetPosition(origin, orxTRUE);
+  Particles::Get().Render(*_rstPayload.stObject.pstTransform, origin);
+
+  // The field's own graphic is only there to get render events
+  return orxFALSE;
+}
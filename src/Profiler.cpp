@@ -0,0 +1,125 @@
+/**
+ * @file Profiler.cpp
+ * @date 19-Oct-2026
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "Profiler.h"
+
+#ifdef __orxPROFILER__
+
+namespace
+{
+  const orxSTRING kindNames[] = {"Update", "Collide"};
+  static_assert(sizeof(kindNames) / sizeof(kindNames[0]) == static_cast<size_t>(game::Profiler::Kind::Count), "One name per kind");
+
+  /// Profiler.Show
+  void orxFASTCALL CommandShow(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    game::Profiler::Get().Show();
+    _pstResult->bValue = orxTRUE;
+  }
+
+  /// Profiler.Dump [Path]
+  void orxFASTCALL CommandDump(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    _pstResult->bValue = game::Profiler::Get().Dump((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL) ? orxTRUE : orxFALSE;
+  }
+
+  /// Profiler.Reset
+  void orxFASTCALL CommandReset(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    game::Profiler::Get().Reset();
+    _pstResult->bValue = orxTRUE;
+  }
+}
+
+#endif // __orxPROFILER__
+
+game::Profiler &game::Profiler::Get()
+{
+  static Profiler instance;
+  return instance;
+}
+
+void game::Profiler::Init()
+{
+#ifdef __orxPROFILER__
+  static const orxCOMMAND_VAR_DEF result = {"Success", orxCOMMAND_VAR_TYPE_BOOL};
+  static const orxCOMMAND_VAR_DEF params[] = {{"Path = Profiler.File", orxCOMMAND_VAR_TYPE_STRING}};
+
+  orxCommand_Register("Profiler.Show", &CommandShow, 0, 0, orxNULL, &result);
+  orxCommand_Register("Profiler.Dump", &CommandDump, 0, 1, params, &result);
+  orxCommand_Register("Profiler.Reset", &CommandReset, 0, 0, orxNULL, &result);
+#endif // __orxPROFILER__
+}
+
+void game::Profiler::Exit()
+{
+#ifdef __orxPROFILER__
+  orxCommand_Unregister("Profiler.Show");
+  orxCommand_Unregister("Profiler.Dump");
+  orxCommand_Unregister("Profiler.Reset");
+
+  entries.clear();
+#endif // __orxPROFILER__
+}
+
+#ifdef __orxPROFILER__
+
+void game::Profiler::Record(orxSTRINGID model, Kind kind, orxDOUBLE duration)
+{
+  auto &entry = entries[{model, kind}];
+  entry.count++;
+  entry.total += duration;
+  entry.max = std::max(entry.max, duration);
+}
+
+void game::Profiler::Show() const
+{
+  std::vector<std::pair<Key, Entry>> sorted(entries.begin(), entries.end());
+  std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b)
+            { return a.second.total > b.second.total; });
+
+  orxLOG("[PROFILER] %-24s %-8s %8s %10s %10s %10s", "Model", "Kind", "Calls", "Total(ms)", "Avg(us)", "Max(us)");
+  for (const auto &[key, entry] : sorted)
+  {
+    orxLOG("[PROFILER] %-24s %-8s %8u %10.3f %10.3f %10.3f", orxString_GetFromID(key.first), kindNames[static_cast<size_t>(key.second)], entry.count, entry.total * 1000.0, entry.total * 1000000.0 / entry.count, entry.max * 1000000.0);
+  }
+}
+
+bool game::Profiler::Dump(const orxSTRING path) const
+{
+  if (path == orxNULL || *path == orxCHAR_NULL)
+  {
+    orxConfig_PushSection("Profiler");
+    path = orxConfig_GetString("File");
+    orxConfig_PopSection();
+  }
+
+  auto file = orxFile_Open(path, orxFILE_KU32_FLAG_OPEN_WRITE);
+  if (file == orxNULL)
+  {
+    orxLOG("[PROFILER] Can't open <%s> for writing.", path);
+    return false;
+  }
+
+  orxFile_Print(file, "Model,Kind,Calls,TotalMs,AvgUs,MaxUs\n");
+  for (const auto &[key, entry] : entries)
+  {
+    orxFile_Print(file, "%s,%s,%u,%.3f,%.3f,%.3f\n", orxString_GetFromID(key.first), kindNames[static_cast<size_t>(key.second)], entry.count, entry.total * 1000.0, entry.total * 1000000.0 / entry.count, entry.max * 1000000.0);
+  }
+  orxFile_Close(file);
+
+  orxLOG("[PROFILER] Dumped %u entries to <%s>.", (orxU32)entries.size(), path);
+  return true;
+}
+
+void game::Profiler::Reset()
+{
+  entries.clear();
+}
+
+#endif // __orxPROFILER__
@@ -0,0 +1,158 @@
+/**
+ * @file Random.cpp
+ * @date 19-Oct-2026
+ */
+
+#include "Random.h"
+
+namespace
+{
+  /// @brief Mix a 64-bit value, used to derive well-spread seeds
+  orxU64 SplitMix64(orxU64 value)
+  {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+  }
+
+  /// Random.Reset [Seed]
+  void orxFASTCALL CommandReset(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    _pstResult->u64Value = game::Random::Get().Reset((_u32ArgNumber > 0) ? _astArgList[0].u64Value : 0);
+  }
+
+  /// Random.Pick Section Key [Gameplay]
+  void orxFASTCALL CommandPick(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    // Same convention as config commands: @ is the current section
+    auto section = _astArgList[0].zValue;
+    if (orxString_Compare(section, "@") == 0)
+    {
+      section = orxConfig_GetCurrentSection();
+    }
+
+    const auto stream = ((_u32ArgNumber > 2) && _astArgList[2].bValue) ? game::Random::Stream::Gameplay : game::Random::Stream::Cosmetic;
+
+    orxConfig_PushSection(section);
+    _pstResult->zValue = game::Random::Get().PickListString(stream, _astArgList[1].zValue);
+    orxConfig_PopSection();
+  }
+}
+
+void game::RandomStream::Seed(orxU64 seed, orxU64 sequence)
+{
+  state = 0;
+  increment = (sequence << 1) | 1;
+  Next();
+  state += seed;
+  Next();
+}
+
+orxU32 game::RandomStream::Next()
+{
+  const auto previous = state;
+  state = previous * 6364136223846793005ULL + increment;
+  const auto xorShifted = static_cast<orxU32>(((previous >> 18) ^ previous) >> 27);
+  const auto rotation = static_cast<orxU32>(previous >> 59);
+  return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+}
+
+orxU32 game::RandomStream::NextIndex(orxU32 count)
+{
+  if (count <= 1)
+  {
+    return 0;
+  }
+
+  // Rejects the low values that would bias the modulo
+  const auto threshold = (0u - count) % count;
+  for (;;)
+  {
+    const auto value = Next();
+    if (value >= threshold)
+    {
+      return value % count;
+    }
+  }
+}
+
+orxFLOAT game::RandomStream::NextFloat(orxFLOAT min, orxFLOAT max)
+{
+  // 24 bits fit exactly in a float's mantissa
+  const auto unit = static_cast<orxFLOAT>(Next() >> 8) * (orxFLOAT_1 / 16777216.0f);
+  return min + (max - min) * unit;
+}
+
+game::Random &game::Random::Get()
+{
+  static Random instance;
+  return instance;
+}
+
+void game::Random::Init()
+{
+  static const orxCOMMAND_VAR_DEF resetResult = {"Seed", orxCOMMAND_VAR_TYPE_U64};
+  static const orxCOMMAND_VAR_DEF resetParams[] = {{"Seed = 0", orxCOMMAND_VAR_TYPE_U64}};
+  static const orxCOMMAND_VAR_DEF pickResult = {"Item", orxCOMMAND_VAR_TYPE_STRING};
+  static const orxCOMMAND_VAR_DEF pickParams[] = {{"Section", orxCOMMAND_VAR_TYPE_STRING}, {"Key", orxCOMMAND_VAR_TYPE_STRING}, {"Gameplay = false", orxCOMMAND_VAR_TYPE_BOOL}};
+
+  orxCommand_Register("Random.Reset", &CommandReset, 0, 1, resetParams, &resetResult);
+  orxCommand_Register("Random.Pick", &CommandPick, 2, 1, pickParams, &pickResult);
+
+  Reset();
+}
+
+void game::Random::Exit()
+{
+  orxCommand_Unregister("Random.Reset");
+  orxCommand_Unregister("Random.Pick");
+}
+
+orxU64 game::Random::Reset(orxU64 requested)
+{
+  if (requested == 0)
+  {
+    orxConfig_PushSection("Random");
+    requested = orxConfig_GetU64("Seed");
+    orxConfig_PopSection();
+  }
+
+  // No seed given or configured: pick a fresh one, it gets logged below
+  if (requested == 0)
+  {
+    requested = SplitMix64(static_cast<orxU64>(orxSystem_GetRealTime() * 1000000.0) ^ seed);
+  }
+
+  seed = requested;
+  gameplay.Seed(SplitMix64(seed), 1);
+  cosmetic.Seed(SplitMix64(seed ^ 0xC05E71C5ULL), 2);
+
+  // Config lists & ranges use orx's own generator, it follows the cosmetic stream
+  orxMath_InitRandom(cosmetic.Next());
+
+  orxLOG("[RANDOM] Seed %llu", static_cast<unsigned long long>(seed));
+
+  return seed;
+}
+
+orxU64 game::Random::GetSeed() const
+{
+  return seed;
+}
+
+game::RandomStream &game::Random::GetStream(Stream stream)
+{
+  return (stream == Stream::Gameplay) ? gameplay : cosmetic;
+}
+
+const orxSTRING game::Random::PickListString(Stream stream, const orxSTRING key)
+{
+  const auto count = static_cast<orxU32>(orxConfig_GetListCount(key));
+  if (count == 0)
+  {
+    return orxSTRING_EMPTY;
+  }
+
+  return orxConfig_GetListString(key, static_cast<orxS32>(GetStream(stream).NextIndex(count)));
+}
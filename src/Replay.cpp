@@ -0,0 +1,384 @@
+/**
+ * @file Replay.cpp
+ * @date 19-Oct-2026
+ */
+
+#include "Random.h"
+#include "Replay.h"
+
+namespace
+{
+  constexpr orxCHAR replayTag[4] = {'P', 'R', 'P', '3'};
+
+  /// On-disk replay header, followed by one update count per frame, one
+  /// packed input per update and one length-prefixed name per drop
+  struct ReplayHeader
+  {
+    orxCHAR tag[4];
+    orxFLOAT stepDT;
+    orxU64 seed;
+    orxU32 frameCount;
+    orxU32 inputCount;
+    orxU32 dropCount;
+  };
+
+  constexpr orxU8 inputFlagDrop = 0x01;
+  constexpr orxU8 inputFlagGameOver = 0x02;
+
+  /// Smallest encodings: an update count per frame, left, right & flags per
+  /// input, an empty name per drop
+  constexpr orxS64 frameSize = sizeof(orxU8);
+  constexpr orxS64 inputSize = 2 * sizeof(orxFLOAT) + sizeof(orxU8);
+  constexpr orxS64 dropSize = sizeof(orxU8);
+
+  bool Write(orxFILE *file, const void *data, orxS64 size)
+  {
+    return size == 0 || orxFile_Write(data, size, 1, file) == 1;
+  }
+
+  bool Read(orxFILE *file, void *data, orxS64 size)
+  {
+    return size == 0 || orxFile_Read(data, size, 1, file) == 1;
+  }
+}
+
+game::Replay &game::Replay::Get()
+{
+  static Replay instance;
+  return instance;
+}
+
+bool game::Replay::Init()
+{
+  // Latches presses every frame, before the fixed updates run
+  orxClock_Register(orxClock_Get(orxCLOCK_KZ_CORE), &Replay::OnClockInput, this, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_HIGH);
+
+  orxConfig_PushSection("Replay");
+  const auto playPath = orxConfig_GetString("Play");
+  const auto recordPath = orxConfig_GetString("Record");
+  orxConfig_PopSection();
+
+  // Recordings are made of fixed update counts
+  auto &game = planet::GetInstance();
+  if ((*playPath != orxCHAR_NULL || *recordPath != orxCHAR_NULL) && !game.IsFixedStep())
+  {
+    orxLOG("[REPLAY] Ignored: replays require fixed-step updates, see the FixedStep config section.");
+    return false;
+  }
+
+  if (*playPath != orxCHAR_NULL)
+  {
+    path = playPath;
+    if (!Load())
+    {
+      return false;
+    }
+    mode = Mode::Play;
+
+    // Cosmetic randomness isn't recorded, it's reproduced from the session seed
+    Random::Get().Reset(seed);
+
+    // Re-simulate as fast as possible: no frame rate cap, no DT cap (frame
+    // DTs are driven by the recording), no vsync, no rendering and no sound
+    auto clock = orxClock_Get(orxCLOCK_KZ_CORE);
+    orxClock_SetTickSize(clock, orxFLOAT_0);
+    orxClock_SetModifier(clock, orxCLOCK_MODIFIER_MAXED, orxFLOAT_0);
+    orxDisplay_EnableVSync(orxFALSE);
+    orxViewport_Enable(game.GetMainViewport(), orxFALSE);
+    orxSound_SetBusVolume(orxSound_GetMasterBusID(), orxFLOAT_0);
+  }
+  else if (*recordPath != orxCHAR_NULL)
+  {
+    path = recordPath;
+    mode = Mode::Record;
+  }
+
+  if (mode != Mode::Off)
+  {
+    // Runs after all other updates of the frame
+    orxClock_Register(orxClock_Get(orxCLOCK_KZ_CORE), &Replay::OnClockUpdate, this, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_LOWEST);
+  }
+
+  return IsPlaying();
+}
+
+void game::Replay::Exit()
+{
+  // Don't lose a session in progress when quitting
+  if (IsRecording())
+  {
+    StopSession();
+  }
+
+  orxClock_Unregister(orxClock_Get(orxCLOCK_KZ_CORE), &Replay::OnClockInput);
+
+  if (mode != Mode::Off)
+  {
+    orxClock_Unregister(orxClock_Get(orxCLOCK_KZ_CORE), &Replay::OnClockUpdate);
+    mode = Mode::Off;
+  }
+}
+
+bool game::Replay::IsRecording() const
+{
+  return mode == Mode::Record;
+}
+
+bool game::Replay::IsPlaying() const
+{
+  return mode == Mode::Play;
+}
+
+void game::Replay::StartSession()
+{
+  if (mode == Mode::Off || inSession)
+  {
+    return;
+  }
+
+  inSession = true;
+
+  if (IsRecording())
+  {
+    frames.clear();
+    inputs.clear();
+    drops.clear();
+    inputsThisFrame = 0;
+    seed = Random::Get().GetSeed();
+  }
+  else
+  {
+    frameIndex = 0;
+    inputIndex = 0;
+    dropIndex = 0;
+    startTime = orxSystem_GetTime();
+    if (!frames.empty())
+    {
+      SetNextFrameDT(frames[frameIndex++]);
+    }
+  }
+}
+
+void game::Replay::StopSession()
+{
+  if (!inSession)
+  {
+    return;
+  }
+
+  inSession = false;
+
+  if (IsRecording())
+  {
+    Save();
+  }
+  else
+  {
+    orxLOG("[REPLAY] Played %u frames (%u updates, %u drops) from <%s> in %.3fs.", (orxU32)frameIndex, (orxU32)inputIndex, (orxU32)dropIndex, path.c_str(), orxSystem_GetTime() - startTime);
+
+    // Playback is a one-shot run
+    orxEvent_SendShort(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_CLOSE);
+  }
+}
+
+game::ReplayInput game::Replay::SampleInput()
+{
+  ReplayInput input{};
+
+  if (IsPlaying())
+  {
+    if (inSession && inputIndex < inputs.size())
+    {
+      input = inputs[inputIndex++];
+    }
+  }
+  else
+  {
+    input.left = orxInput_GetValue("Left");
+    input.right = orxInput_GetValue("Right");
+    input.drop = dropLatched;
+    input.gameOver = gameOverLatched;
+    dropLatched = false;
+    gameOverLatched = false;
+
+    if (IsRecording() && inSession)
+    {
+      inputs.push_back(input);
+      inputsThisFrame++;
+    }
+  }
+
+  return input;
+}
+
+const orxSTRING game::Replay::ChooseDrop()
+{
+  if (IsPlaying() && inSession)
+  {
+    if (dropIndex < drops.size())
+    {
+      return drops[dropIndex++].c_str();
+    }
+    orxLOG("[REPLAY] Out of recorded drops, playback has diverged from <%s>.", path.c_str());
+  }
+
+  const auto drop = Random::Get().PickListString(Random::Stream::Gameplay, "Drop");
+
+  if (IsRecording() && inSession)
+  {
+    drops.emplace_back(drop);
+  }
+
+  return drop;
+}
+
+void game::Replay::Save() const
+{
+  auto file = orxFile_Open(path.c_str(), orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+  if (file == orxNULL)
+  {
+    orxLOG("[REPLAY] Can't open <%s> for writing.", path.c_str());
+    return;
+  }
+
+  ReplayHeader header{};
+  orxMemory_Copy(header.tag, replayTag, sizeof(replayTag));
+  header.stepDT = planet::GetInstance().GetFixedStepDT();
+  header.seed = seed;
+  header.frameCount = static_cast<orxU32>(frames.size());
+  header.inputCount = static_cast<orxU32>(inputs.size());
+  header.dropCount = static_cast<orxU32>(drops.size());
+
+  auto ok = Write(file, &header, sizeof(header)) && Write(file, frames.data(), frames.size());
+  for (const auto &input : inputs)
+  {
+    const orxU8 flags = (input.drop ? inputFlagDrop : 0) | (input.gameOver ? inputFlagGameOver : 0);
+    ok = ok && Write(file, &input.left, sizeof(orxFLOAT)) && Write(file, &input.right, sizeof(orxFLOAT)) && Write(file, &flags, sizeof(orxU8));
+  }
+  for (const auto &drop : drops)
+  {
+    const auto length = static_cast<orxU8>(orxMIN(drop.size(), (size_t)0xFF));
+    ok = ok && Write(file, &length, sizeof(orxU8)) && Write(file, drop.data(), length);
+  }
+
+  orxFile_Close(file);
+
+  if (ok)
+  {
+    orxLOG("[REPLAY] Recorded %u frames (%u updates, %u drops) to <%s>.", header.frameCount, header.inputCount, header.dropCount, path.c_str());
+  }
+  else
+  {
+    orxLOG("[REPLAY] Failed writing <%s>.", path.c_str());
+  }
+}
+
+bool game::Replay::Load()
+{
+  auto file = orxFile_Open(path.c_str(), orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+  if (file == orxNULL)
+  {
+    orxLOG("[REPLAY] Can't open <%s> for reading.", path.c_str());
+    return false;
+  }
+
+  ReplayHeader header{};
+  auto ok = Read(file, &header, sizeof(header)) && orxMemory_Compare(header.tag, replayTag, sizeof(replayTag)) == 0;
+
+  // Counts that can't fit in the rest of the file are corrupt, rather than allocated
+  const orxS64 left = orxFile_GetSize(file) - static_cast<orxS64>(sizeof(header));
+  ok = ok && header.frameCount * frameSize + header.inputCount * inputSize + header.dropCount * dropSize <= left;
+
+  if (ok)
+  {
+    if (header.stepDT != planet::GetInstance().GetFixedStepDT())
+    {
+      orxLOG("[REPLAY] <%s> was recorded with a different fixed step, playback will diverge.", path.c_str());
+    }
+
+    seed = header.seed;
+
+    frames.resize(header.frameCount);
+    ok = Read(file, frames.data(), frames.size());
+
+    inputs.resize(header.inputCount);
+    for (auto &input : inputs)
+    {
+      orxU8 flags = 0;
+      ok = ok && Read(file, &input.left, sizeof(orxFLOAT)) && Read(file, &input.right, sizeof(orxFLOAT)) && Read(file, &flags, sizeof(orxU8));
+      input.drop = (flags & inputFlagDrop) != 0;
+      input.gameOver = (flags & inputFlagGameOver) != 0;
+    }
+
+    drops.resize(header.dropCount);
+    for (auto &drop : drops)
+    {
+      orxU8 length = 0;
+      ok = ok && Read(file, &length, sizeof(orxU8));
+      drop.resize(length);
+      ok = ok && Read(file, drop.data(), length);
+    }
+  }
+
+  orxFile_Close(file);
+
+  if (!ok)
+  {
+    orxLOG("[REPLAY] <%s> is not a valid replay.", path.c_str());
+  }
+
+  return ok;
+}
+
+void game::Replay::SetNextFrameDT(orxU32 updates) const
+{
+  // Aims halfway between update boundaries so that float drift in the
+  // accumulators can never gain or lose an update. Physics steps at the same
+  // frequency from the same DTs, so it follows along.
+  const auto &game = planet::GetInstance();
+  const auto stepDT = game.GetFixedStepDT();
+  auto dt = orxU2F(updates) * stepDT + 0.5f * stepDT - game.GetFixedStepAlpha() * stepDT;
+
+  // A fixed modifier of 0 would disable it
+  dt = orxMAX(dt, 0.001f * stepDT);
+
+  orxClock_SetModifier(orxClock_Get(orxCLOCK_KZ_CORE), orxCLOCK_MODIFIER_FIXED, dt);
+}
+
+void orxFASTCALL game::Replay::OnClockUpdate(const orxCLOCK_INFO *_pstInfo, void *_pContext)
+{
+  auto &replay = *static_cast<Replay *>(_pContext);
+
+  if (!replay.inSession)
+  {
+    return;
+  }
+
+  if (replay.IsRecording())
+  {
+    // Sessions start mid-frame, only count the updates the scene actually got in its first frame
+    const auto updates = replay.frames.empty() ? replay.inputsThisFrame : planet::GetInstance().GetFixedStepCount();
+    replay.frames.push_back(static_cast<orxU8>(orxMIN(updates, 0xFFu)));
+    replay.inputsThisFrame = 0;
+  }
+  else if (replay.frameIndex < replay.frames.size())
+  {
+    replay.SetNextFrameDT(replay.frames[replay.frameIndex++]);
+  }
+  else
+  {
+    replay.StopSession();
+  }
+}
+
+void orxFASTCALL game::Replay::OnClockInput(const orxCLOCK_INFO *_pstInfo, void *_pContext)
+{
+  auto &replay = *static_cast<Replay *>(_pContext);
+
+  // Frames can run no fixed update at all, a press must then wait for the next one
+  if (!replay.IsPlaying())
+  {
+    replay.dropLatched = replay.dropLatched || orxInput_HasBeenActivated("Drop");
+    replay.gameOverLatched = replay.gameOverLatched || orxInput_HasBeenActivated("GameOver");
+  }
+}
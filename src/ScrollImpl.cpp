@@ -0,0 +1,13 @@
+/**
+ * @file ScrollImpl.cpp
+ * @date 19-Oct-2026
+ */
+
+// Scroll's implementation lives in its own translation unit so that editing
+// game code doesn't recompile it, and vice versa
+#define __SCROLL_IMPL__
+#include "planet.h"
+#undef __SCROLL_IMPL__
+
+// Emits all of Scroll<planet>'s members here, the other units only see declarations
+template class Scroll<planet>;
@@ -0,0 +1,330 @@
+/**
+ * @file SdfFont.cpp
+ * @date 19-Oct-2026
+ */
+
+#include <cmath>
+#include <limits>
+
+#include "Extensions.h"
+#include "SdfFont.h"
+
+namespace
+{
+  constexpr orxU32 bytesPerPixel = 4;
+  constexpr orxFLOAT infinity = std::numeric_limits<orxFLOAT>::infinity();
+  /// Unreached distance, finite so the transform's arithmetic stays defined
+  constexpr orxFLOAT far = 1e20f;
+
+  /// @brief Squared distance transform of a sampled function, in one dimension
+  /// (Felzenszwalb & Huttenlocher), `f` is read with `stride` and overwritten
+  void Transform1D(orxFLOAT *f, orxU32 count, orxU32 stride, std::vector<orxFLOAT> &d, std::vector<orxU32> &v, std::vector<orxFLOAT> &z)
+  {
+    d.resize(count);
+    v.resize(count);
+    z.resize(count + 1);
+
+    orxU32 k = 0;
+    v[0] = 0;
+    z[0] = -infinity;
+    z[1] = infinity;
+    for (orxU32 q = 1; q < count; q++)
+    {
+      const auto fq = f[q * stride] + orxU2F(q * q);
+      auto s = (fq - (f[v[k] * stride] + orxU2F(v[k] * v[k]))) / orxU2F(2 * q - 2 * v[k]);
+      while (s <= z[k])
+      {
+        k--;
+        s = (fq - (f[v[k] * stride] + orxU2F(v[k] * v[k]))) / orxU2F(2 * q - 2 * v[k]);
+      }
+      k++;
+      v[k] = q;
+      z[k] = s;
+      z[k + 1] = infinity;
+    }
+
+    k = 0;
+    for (orxU32 q = 0; q < count; q++)
+    {
+      while (z[k + 1] < orxU2F(q))
+      {
+        k++;
+      }
+      const auto delta = orxU2F(q) - orxU2F(v[k]);
+      d[q] = delta * delta + f[v[k] * stride];
+    }
+    for (orxU32 q = 0; q < count; q++)
+    {
+      f[q * stride] = d[q];
+    }
+  }
+
+  /// @brief Distance from each texel where `mask` is `inside` to the nearest one where it isn't, 0 elsewhere
+  std::vector<orxFLOAT> DistanceTo(const std::vector<bool> &mask, bool inside, orxU32 width, orxU32 height)
+  {
+    std::vector<orxFLOAT> grid(mask.size());
+    for (size_t i = 0; i < mask.size(); i++)
+    {
+      grid[i] = (mask[i] == inside) ? far : orxFLOAT_0;
+    }
+
+    std::vector<orxFLOAT> d, z;
+    std::vector<orxU32> v;
+    for (orxU32 x = 0; x < width; x++)
+    {
+      Transform1D(&grid[x], height, width, d, v, z);
+    }
+    for (orxU32 y = 0; y < height; y++)
+    {
+      Transform1D(&grid[static_cast<size_t>(y) * width], width, 1, d, v, z);
+    }
+    for (auto &value : grid)
+    {
+      value = std::sqrt(value);
+    }
+    return grid;
+  }
+
+  const orxSTRING LocateOutput(const orxSTRING group, const orxSTRING storageKey, const orxSTRING name)
+  {
+    return orxResource_LocateInStorage(group, orxConfig_GetString(storageKey), name);
+  }
+}
+
+game::SdfFont &game::SdfFont::Get()
+{
+  static SdfFont instance;
+  return instance;
+}
+
+void game::SdfFont::Init(bool build)
+{
+  if (build)
+  {
+    Build();
+  }
+
+  orxConfig_PushSection("SdfFont");
+  const auto config = orxConfig_GetString("Config");
+  orxConfig_PopSection();
+
+  // Text keeps the bitmap font unless a distance field has just been generated or bundled
+  const auto location = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, config);
+  if (location != orxNULL && (build || IsBundled(location)))
+  {
+    orxConfig_Load(config);
+  }
+}
+
+orxU32 game::SdfFont::Layout(const std::vector<orxU32> &widths, orxU32 height, const orxVECTOR &spacing, orxU32 textureWidth, std::vector<Cell> &cells)
+{
+  const auto spacingX = orxF2U(spacing.fX), spacingY = orxF2U(spacing.fY);
+  orxU32 x = 0, y = 0;
+  cells.clear();
+  for (const auto width : widths)
+  {
+    if (x + width > textureWidth)
+    {
+      x = 0;
+      y += height + spacingY;
+    }
+    cells.push_back({x, y, width});
+    x += width + spacingX;
+  }
+  return y + height;
+}
+
+bool game::SdfFont::Build() const
+{
+  const auto startTime = orxSystem_GetTime();
+
+  orxConfig_PushSection("SdfFont");
+  const auto font = orxString_Store(orxConfig_GetString("Font"));
+  const auto texture = orxString_Store(orxConfig_GetString("Texture"));
+  const auto height = orxConfig_GetU32("CharacterHeight");
+  const auto spread = orxConfig_GetFloat("Spread");
+  const auto textureWidth = orxConfig_GetU32("TextureWidth");
+  const auto textureLocation = LocateOutput(orxTEXTURE_KZ_RESOURCE_GROUP, "TextureStorage", texture);
+  orxConfig_PopSection();
+
+  // Source font description
+  orxConfig_PushSection(font);
+  const auto sourceTexture = orxString_Store(orxConfig_GetString("Texture"));
+  const auto sourceHeight = orxF2U(orxConfig_GetFloat("CharacterHeight"));
+  orxVECTOR spacing = orxVECTOR_0;
+  orxConfig_GetVector("CharacterSpacing", &spacing);
+  std::vector<orxU32> sourceWidths;
+  for (orxS32 i = 0, count = orxConfig_GetListCount("CharacterWidthList"); i < count; i++)
+  {
+    sourceWidths.push_back(orxF2U(orxConfig_GetListFloat("CharacterWidthList", i)));
+  }
+  orxConfig_PopSection();
+
+  if (textureLocation == orxNULL || height == 0 || sourceHeight == 0 || sourceWidths.empty())
+  {
+    orxLOG("[SDFFONT] Invalid config for <%s>.", font);
+    return false;
+  }
+
+  // Loads synchronously, the pixels are needed right away
+  const auto tempBitmap = orxDisplay_GetTempBitmap();
+  orxDisplay_SetTempBitmap(orxNULL);
+
+  auto source = orxDisplay_LoadBitmap(sourceTexture);
+  if (source == orxNULL)
+  {
+    orxDisplay_SetTempBitmap(tempBitmap);
+    orxLOG("[SDFFONT] Can't load <%s>.", sourceTexture);
+    return false;
+  }
+  orxFLOAT sourceTextureWidth, sourceTextureHeight;
+  orxDisplay_GetBitmapSize(source, &sourceTextureWidth, &sourceTextureHeight);
+  const auto sourceStride = orxF2U(sourceTextureWidth);
+  std::vector<orxU8> sourcePixels(static_cast<size_t>(sourceStride) * orxF2U(sourceTextureHeight) * bytesPerPixel);
+  auto ok = orxDisplay_GetBitmapData(source, sourcePixels.data(), static_cast<orxU32>(sourcePixels.size())) != orxSTATUS_FAILURE;
+  orxDisplay_DeleteBitmap(source);
+
+  // Same layout, scaled down
+  const auto scale = orxU2F(sourceHeight) / orxU2F(height);
+  std::vector<orxU32> widths;
+  for (const auto width : sourceWidths)
+  {
+    widths.push_back(orxMAX(orxF2U(orxMath_Round(orxU2F(width) / scale)), 1u));
+  }
+  std::vector<Cell> sourceCells, cells;
+  Layout(sourceWidths, sourceHeight, spacing, sourceStride, sourceCells);
+  const auto textureHeight = Layout(widths, height, spacing, textureWidth, cells);
+
+  std::vector<orxU8> pixels;
+  if (ok)
+  {
+    pixels.resize(static_cast<size_t>(textureWidth) * textureHeight * bytesPerPixel, 0);
+
+    for (size_t glyph = 0; glyph < cells.size(); glyph++)
+    {
+      // Distances in the source cell only, so neighbours don't leak in
+      const auto &sourceCell = sourceCells[glyph];
+      const auto cellWidth = orxMIN(sourceCell.width, sourceStride - orxMIN(sourceCell.x, sourceStride));
+      const auto cellHeight = orxMIN(sourceHeight, orxF2U(sourceTextureHeight) - orxMIN(sourceCell.y, orxF2U(sourceTextureHeight)));
+      if (cellWidth == 0 || cellHeight == 0)
+      {
+        continue;
+      }
+      std::vector<bool> mask(static_cast<size_t>(cellWidth) * cellHeight);
+      for (orxU32 y = 0; y < cellHeight; y++)
+      {
+        for (orxU32 x = 0; x < cellWidth; x++)
+        {
+          mask[static_cast<size_t>(y) * cellWidth + x] = sourcePixels[((static_cast<size_t>(sourceCell.y + y) * sourceStride) + sourceCell.x + x) * bytesPerPixel + 3] >= 0x80;
+        }
+      }
+      const auto inside = DistanceTo(mask, true, cellWidth, cellHeight);
+      const auto outside = DistanceTo(mask, false, cellWidth, cellHeight);
+
+      // Samples at texel centers, distance in destination texels mapped to [0, 1] around the 0.5 edge
+      const auto &cell = cells[glyph];
+      for (orxU32 y = 0; y < height; y++)
+      {
+        const auto sourceY = orxMIN(orxF2U((orxU2F(y) + 0.5f) * scale), cellHeight - 1);
+        for (orxU32 x = 0; x < cell.width; x++)
+        {
+          const auto sourceX = orxMIN(orxF2U((orxU2F(x) + 0.5f) * scale), cellWidth - 1);
+          const auto index = static_cast<size_t>(sourceY) * cellWidth + sourceX;
+          const auto distance = (inside[index] - outside[index]) / scale;
+          const auto value = orxCLAMP(0.5f + distance / (2.0f * spread), orxFLOAT_0, orxFLOAT_1);
+          const auto pixel = &pixels[((static_cast<size_t>(cell.y + y) * textureWidth) + cell.x + x) * bytesPerPixel];
+          pixel[0] = pixel[1] = pixel[2] = 0xFF;
+          pixel[3] = static_cast<orxU8>(value * 255.0f + 0.5f);
+        }
+      }
+    }
+
+    auto bitmap = orxDisplay_CreateBitmap(textureWidth, textureHeight);
+    ok = bitmap != orxNULL && orxDisplay_SetBitmapData(bitmap, pixels.data(), static_cast<orxU32>(pixels.size())) != orxSTATUS_FAILURE && orxDisplay_SaveBitmap(bitmap, orxResource_GetPath(textureLocation)) != orxSTATUS_FAILURE;
+    if (bitmap != orxNULL)
+    {
+      orxDisplay_DeleteBitmap(bitmap);
+    }
+  }
+
+  orxDisplay_SetTempBitmap(tempBitmap);
+
+  ok = ok && WriteConfig(widths, scale);
+
+  if (ok)
+  {
+    // The bitmap font isn't used anymore, keeps it out of the bundle
+    orxConfig_PushSection("Bundle");
+    orxConfig_AppendListString("ExcludeList", &sourceTexture, 1);
+    orxConfig_PopSection();
+
+    orxLOG("[SDFFONT] Generated <%s> (%ux%u) from <%s> in %.2fms.", texture, textureWidth, textureHeight, sourceTexture, (orxSystem_GetTime() - startTime) * 1000.0);
+  }
+  else
+  {
+    orxLOG("[SDFFONT] Failed generating <%s>, text keeps the bitmap font.", texture);
+  }
+  return ok;
+}
+
+bool game::SdfFont::WriteConfig(const std::vector<orxU32> &widths, orxFLOAT scale) const
+{
+  orxConfig_PushSection("SdfFont");
+  const auto font = orxString_Store(orxConfig_GetString("Font"));
+  const auto name = orxString_Store(orxConfig_GetString("Name"));
+  const auto texture = orxString_Store(orxConfig_GetString("Texture"));
+  const auto shader = orxString_Store(orxConfig_GetString("Shader"));
+  const auto height = orxConfig_GetU32("CharacterHeight");
+  const auto config = orxConfig_GetString("Config");
+  const auto location = LocateOutput(orxCONFIG_KZ_RESOURCE_GROUP, "ConfigStorage", config);
+  std::vector<const orxSTRING> objects;
+  for (orxS32 i = 0, count = orxConfig_GetListCount("ObjectList"); i < count; i++)
+  {
+    objects.push_back(orxString_Store(orxConfig_GetListString("ObjectList", i)));
+  }
+  orxConfig_PopSection();
+
+  const auto output = (location != orxNULL) ? orxResource_Open(location, orxTRUE) : orxHANDLE_UNDEFINED;
+  if (output == orxHANDLE_UNDEFINED)
+  {
+    orxLOG("[SDFFONT] Can't open <%s> for writing.", config);
+    return false;
+  }
+
+  orxCHAR buffer[256];
+  const auto write = [&buffer, output](orxS32 length)
+  {
+    orxResource_Write(output, static_cast<orxS64>(length), buffer, orxNULL, orxNULL);
+  };
+
+  // Inherits the character list & spacing from the bitmap font
+  write(orxString_NPrint(buffer, sizeof(buffer), "; Generated by the SDF font generator when bundling, do not edit\r\n\r\n[%s@%s]\r\nTexture = %s\r\nCharacterHeight = %u\r\nCharacterWidthList =", name, font, texture, height));
+  for (size_t i = 0; i < widths.size(); i++)
+  {
+    write(orxString_NPrint(buffer, sizeof(buffer), (i == 0) ? " %u" : " # %u", widths[i]));
+  }
+  write(orxString_NPrint(buffer, sizeof(buffer), "\r\n"));
+
+  // Text objects use the new font, rendered through the shader, scaled up to keep their size
+  for (const auto object : objects)
+  {
+    orxConfig_PushSection(object);
+    orxVECTOR objectScale;
+    if (orxConfig_GetVector("Scale", &objectScale) == orxNULL)
+    {
+      orxVector_SetAll(&objectScale, orxConfig_HasValue("Scale") ? orxConfig_GetFloat("Scale") : orxFLOAT_1);
+    }
+    const auto graphic = orxString_Store(orxConfig_GetString("Graphic"));
+    orxConfig_PopSection();
+
+    write(orxString_NPrint(buffer, sizeof(buffer), "\r\n[%s]\r\nScale           = (%g, %g)\r\nShaderList      = %s\r\n", object, objectScale.fX * scale, objectScale.fY * scale, shader));
+    if (orxString_Compare(graphic, object) != 0)
+    {
+      write(orxString_NPrint(buffer, sizeof(buffer), "\r\n[%s]\r\n", graphic));
+    }
+    write(orxString_NPrint(buffer, sizeof(buffer), "Font            = %s\r\n", name));
+  }
+
+  orxResource_Close(output);
+  return true;
+}
@@ -0,0 +1,348 @@
+/**
+ * @file Snapshot.cpp
+ * @date 19-Oct-2026
+ */
+
+#include <type_traits>
+#include <vector>
+
+#include "Object.h"
+#include "Random.h"
+#include "Snapshot.h"
+
+namespace
+{
+  constexpr orxCHAR snapshotTag[4] = {'P', 'S', 'N', '2'};
+  constexpr orxU8 noModel = 0xFF;
+
+  static_assert(std::is_trivially_copyable_v<game::RandomStream>, "Random streams are saved as raw bytes");
+
+  /// Per-planet record, stored packed
+  struct PlanetRecord
+  {
+    orxU8 model;
+    orxVECTOR position;
+    orxFLOAT rotation;
+    orxVECTOR speed;
+    orxFLOAT angularVelocity;
+    /// Time spent touching the arena top, negative if not touching
+    orxFLOAT arenaTopTime;
+  };
+
+  /// Bytes per planet record in the file: model, then seven floats
+  constexpr size_t serializedRecordSize = sizeof(orxU8) + 7 * sizeof(orxFLOAT);
+
+  /// Append-only byte buffer
+  class Writer
+  {
+  public:
+    template <typename T>
+    void Put(const T &value)
+    {
+      Put(&value, sizeof(T));
+    }
+
+    void Put(const void *data, size_t size)
+    {
+      const auto bytes = static_cast<const orxU8 *>(data);
+      buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    void PutString(const orxSTRING string)
+    {
+      const auto length = static_cast<orxU8>(orxMIN(orxString_GetLength(string), 0xFFu));
+      Put(length);
+      Put(string, length);
+    }
+
+    std::vector<orxU8> buffer{};
+  };
+
+  /// Bounds-checked reader over a loaded file
+  class Reader
+  {
+  public:
+    template <typename T>
+    bool Get(T &value)
+    {
+      return Get(&value, sizeof(T));
+    }
+
+    bool Get(void *data, size_t size)
+    {
+      if (cursor + size > buffer.size())
+      {
+        return false;
+      }
+      orxMemory_Copy(data, buffer.data() + cursor, static_cast<orxU32>(size));
+      cursor += size;
+      return true;
+    }
+
+    /// @brief Read a length-prefixed string and intern it
+    bool GetString(const orxSTRING &string)
+    {
+      orxU8 length = 0;
+      orxCHAR text[256];
+      if (!Get(length) || !Get(text, length))
+      {
+        return false;
+      }
+      text[length] = orxCHAR_NULL;
+      string = orxString_GetFromID(orxString_GetID(text));
+      return true;
+    }
+
+    std::vector<orxU8> buffer{};
+    size_t cursor{0};
+  };
+
+  const orxSTRING GetPath(const orxSTRING path)
+  {
+    if (path == orxNULL || *path == orxCHAR_NULL)
+    {
+      orxConfig_PushSection("Snapshot");
+      path = orxConfig_GetString("File");
+      orxConfig_PopSection();
+    }
+    return path;
+  }
+
+  /// @brief Planets in play, ie. physical ones: the dropper's held planet has no body
+  bool InPlay(game::Planet *planet)
+  {
+    return planet->GetLifeTime() != orxFLOAT_0 && orxOBJECT_GET_STRUCTURE(planet->GetOrxObject(), BODY) != orxNULL;
+  }
+
+  /// Snapshot.Save [Path]
+  void orxFASTCALL CommandSave(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    _pstResult->bValue = game::Snapshot::Get().Save((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL) ? orxTRUE : orxFALSE;
+  }
+
+  /// Snapshot.Load [Path]
+  void orxFASTCALL CommandLoad(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    _pstResult->bValue = game::Snapshot::Get().Load((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL) ? orxTRUE : orxFALSE;
+  }
+}
+
+game::Snapshot &game::Snapshot::Get()
+{
+  static Snapshot instance;
+  return instance;
+}
+
+void game::Snapshot::Init()
+{
+  static const orxCOMMAND_VAR_DEF result = {"Success", orxCOMMAND_VAR_TYPE_BOOL};
+  static const orxCOMMAND_VAR_DEF params[] = {{"Path = Snapshot.File", orxCOMMAND_VAR_TYPE_STRING}};
+
+  orxCommand_Register("Snapshot.Save", &CommandSave, 0, 1, params, &result);
+  orxCommand_Register("Snapshot.Load", &CommandLoad, 0, 1, params, &result);
+}
+
+void game::Snapshot::Exit()
+{
+  orxCommand_Unregister("Snapshot.Save");
+  orxCommand_Unregister("Snapshot.Load");
+}
+
+bool game::Snapshot::Save(const orxSTRING path) const
+{
+  path = GetPath(path);
+
+  auto &game = planet::GetInstance();
+  const auto dropper = game.GetNextObject<Dropper>();
+  if (dropper == orxNULL)
+  {
+    orxLOG("[SNAPSHOT] Can't save <%s>: no game in progress.", path);
+    return false;
+  }
+
+  // Models are stored once and referenced by index
+  std::vector<const orxSTRING> models;
+  const auto modelIndex = [&models](const orxSTRING name) -> orxU8
+  {
+    for (size_t i = 0; i < models.size(); i++)
+    {
+      if (orxString_Compare(models[i], name) == 0)
+      {
+        return static_cast<orxU8>(i);
+      }
+    }
+    models.push_back(name);
+    return static_cast<orxU8>(models.size() - 1);
+  };
+
+  std::vector<PlanetRecord> planets;
+  for (auto planet = game.GetNextObject<Planet>(); planet; planet = game.GetNextObject<Planet>(planet))
+  {
+    if (InPlay(planet))
+    {
+      PlanetRecord record{};
+      record.model = modelIndex(planet->GetModelName());
+      planet->GetPosition(record.position, orxTRUE);
+      record.rotation = planet->GetRotation(orxTRUE);
+      planet->GetSpeed(record.speed);
+      record.angularVelocity = orxObject_GetAngularVelocity(planet->GetOrxObject());
+      record.arenaTopTime = planet->GetState().touchingArenaTop.value_or(-orxFLOAT_1);
+      planets.push_back(record);
+    }
+  }
+
+  const auto state = dropper->GetState();
+  const auto held = (*state.held != orxCHAR_NULL) ? modelIndex(state.held) : noModel;
+
+  orxConfig_PushSection("Runtime");
+  const auto score = orxConfig_GetU32("Score");
+  orxConfig_PopSection();
+
+  Writer writer;
+  writer.Put(snapshotTag, sizeof(snapshotTag));
+  writer.Put(score);
+  writer.Put(static_cast<orxU8>(models.size()));
+  for (const auto model : models)
+  {
+    writer.PutString(model);
+  }
+  writer.Put(state.x);
+  writer.Put(state.dtSinceDrop);
+  writer.Put(static_cast<orxU8>(state.first ? 1 : 0));
+  writer.Put(held);
+  writer.Put(Random::Get().GetStream(Random::Stream::Gameplay));
+  writer.Put(static_cast<orxU32>(planets.size()));
+  for (const auto &record : planets)
+  {
+    writer.Put(record.model);
+    writer.Put(record.position.fX);
+    writer.Put(record.position.fY);
+    writer.Put(record.rotation);
+    writer.Put(record.speed.fX);
+    writer.Put(record.speed.fY);
+    writer.Put(record.angularVelocity);
+    writer.Put(record.arenaTopTime);
+  }
+
+  auto file = orxFile_Open(path, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+  if (file == orxNULL)
+  {
+    orxLOG("[SNAPSHOT] Can't open <%s> for writing.", path);
+    return false;
+  }
+  const auto ok = orxFile_Write(writer.buffer.data(), writer.buffer.size(), 1, file) == 1;
+  orxFile_Close(file);
+
+  orxLOG("[SNAPSHOT] %s <%s>: %u planets, %u bytes.", ok ? "Saved" : "Failed saving", path, (orxU32)planets.size(), (orxU32)writer.buffer.size());
+  return ok;
+}
+
+bool game::Snapshot::Load(const orxSTRING path) const
+{
+  path = GetPath(path);
+
+  auto &game = planet::GetInstance();
+  const auto dropper = game.GetNextObject<Dropper>();
+  if (dropper == orxNULL)
+  {
+    orxLOG("[SNAPSHOT] Can't load <%s>: no game in progress.", path);
+    return false;
+  }
+
+  const auto startTime = orxSystem_GetTime();
+
+  // Reads the whole file at once
+  Reader reader;
+  auto file = orxFile_Open(path, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+  if (file == orxNULL)
+  {
+    orxLOG("[SNAPSHOT] Can't open <%s> for reading.", path);
+    return false;
+  }
+  reader.buffer.resize(static_cast<size_t>(orxFile_GetSize(file)));
+  auto ok = orxFile_Read(reader.buffer.data(), reader.buffer.size(), 1, file) == 1;
+  orxFile_Close(file);
+
+  // Parses everything before touching the scene, so a bad file leaves it untouched
+  orxCHAR tag[4];
+  orxU32 score = 0;
+  orxU8 modelCount = 0;
+  const orxSTRING models[0xFF];
+  Dropper::State state;
+  orxU8 first = 0, held = noModel;
+  RandomStream stream;
+  orxU32 planetCount = 0;
+  std::vector<PlanetRecord> planets;
+
+  ok = ok && reader.Get(tag, sizeof(tag)) && orxMemory_Compare(tag, snapshotTag, sizeof(tag)) == 0 && reader.Get(score) && reader.Get(modelCount);
+  for (orxU8 i = 0; ok && i < modelCount; i++)
+  {
+    ok = reader.GetString(models[i]);
+  }
+  ok = ok && reader.Get(state.x) && reader.Get(state.dtSinceDrop) && reader.Get(first) && reader.Get(held) && reader.Get(stream) && reader.Get(planetCount);
+  ok = ok && (held == noModel || held < modelCount);
+  ok = ok && planetCount <= (reader.buffer.size() - reader.cursor) / serializedRecordSize;
+  if (ok)
+  {
+    planets.resize(planetCount);
+  }
+  for (auto &record : planets)
+  {
+    record.position.fZ = orxFLOAT_0;
+    record.speed.fZ = orxFLOAT_0;
+    ok = ok && reader.Get(record.model) && reader.Get(record.position.fX) && reader.Get(record.position.fY) && reader.Get(record.rotation) && reader.Get(record.speed.fX) && reader.Get(record.speed.fY) && reader.Get(record.angularVelocity) && reader.Get(record.arenaTopTime) && record.model < modelCount;
+  }
+
+  if (!ok)
+  {
+    orxLOG("[SNAPSHOT] <%s> is not a valid snapshot.", path);
+    return false;
+  }
+
+  // Clears the current pile right away so it can't interact with the restored one
+  std::vector<orxOBJECT *> previous;
+  for (auto planet = game.GetNextObject<Planet>(); planet; planet = game.GetNextObject<Planet>(planet))
+  {
+    if (InPlay(planet))
+    {
+      previous.push_back(planet->GetOrxObject());
+    }
+  }
+  for (auto object : previous)
+  {
+    orxObject_Delete(object);
+  }
+
+  for (const auto &record : planets)
+  {
+    auto object = orxObject_CreateFromConfig(models[record.model]);
+    orxObject_SetWorldPosition(object, &record.position);
+    orxObject_SetWorldRotation(object, record.rotation);
+    orxObject_SetSpeed(object, &record.speed);
+    orxObject_SetAngularVelocity(object, record.angularVelocity);
+
+    // Resumes a game over countdown in progress
+    if (auto planet = game.GetObject<Planet>(orxStructure_GetGUID(object)))
+    {
+      Planet::State planetState;
+      if (record.arenaTopTime >= orxFLOAT_0)
+      {
+        planetState.touchingArenaTop = record.arenaTopTime;
+      }
+      planet->SetState(planetState);
+    }
+  }
+
+  state.first = first != 0;
+  state.held = (held != noModel) ? models[held] : orxSTRING_EMPTY;
+  dropper->SetState(state);
+
+  Random::Get().GetStream(Random::Stream::Gameplay) = stream;
+
+  orxConfig_PushSection("Runtime");
+  orxConfig_SetU32("Score", score);
+  orxConfig_PopSection();
+
+  orxLOG("[SNAPSHOT] Loaded <%s>: %u planets in %.2fms.", path, planetCount, (orxSystem_GetTime() - startTime) * 1000.0);
+  return true;
+}
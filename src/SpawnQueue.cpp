@@ -0,0 +1,148 @@
+/**
+ * @file SpawnQueue.cpp
+ * @date 19-Oct-2026
+ */
+
+#include "SpawnQueue.h"
+
+namespace
+{
+  /// SpawnQueue.Create Model Position
+  void orxFASTCALL CommandCreate(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    game::SpawnQueue::Get().Create(_astArgList[0].zValue, _astArgList[1].vValue);
+    _pstResult->zValue = _astArgList[0].zValue;
+  }
+
+  /// SpawnQueue.Fire Object Event
+  void orxFASTCALL CommandFire(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    game::SpawnQueue::Get().Fire(_astArgList[0].u64Value, _astArgList[1].zValue);
+    _pstResult->u64Value = _astArgList[0].u64Value;
+  }
+}
+
+bool game::SpawnQueue::Later::operator()(const Entry &a, const Entry &b) const
+{
+  if (a.wave != b.wave)
+  {
+    return a.wave > b.wave;
+  }
+  if (a.position.fY != b.position.fY)
+  {
+    return a.position.fY < b.position.fY;
+  }
+  return a.sequence > b.sequence;
+}
+
+game::SpawnQueue &game::SpawnQueue::Get()
+{
+  static SpawnQueue instance;
+  return instance;
+}
+
+void game::SpawnQueue::Init()
+{
+  static const orxCOMMAND_VAR_DEF createResult = {"Model", orxCOMMAND_VAR_TYPE_STRING};
+  static const orxCOMMAND_VAR_DEF createParams[] = {{"Model", orxCOMMAND_VAR_TYPE_STRING}, {"Position", orxCOMMAND_VAR_TYPE_VECTOR}};
+  static const orxCOMMAND_VAR_DEF fireResult = {"Object", orxCOMMAND_VAR_TYPE_U64};
+  static const orxCOMMAND_VAR_DEF fireParams[] = {{"Object", orxCOMMAND_VAR_TYPE_U64}, {"Event", orxCOMMAND_VAR_TYPE_STRING}};
+
+  orxCommand_Register("SpawnQueue.Create", &CommandCreate, 2, 0, createParams, &createResult);
+  orxCommand_Register("SpawnQueue.Fire", &CommandFire, 2, 0, fireParams, &fireResult);
+}
+
+void game::SpawnQueue::Exit()
+{
+  Clear();
+
+  orxCommand_Unregister("SpawnQueue.Create");
+  orxCommand_Unregister("SpawnQueue.Fire");
+}
+
+void game::SpawnQueue::Create(const orxSTRING model, const orxVECTOR &position)
+{
+  Entry entry;
+  entry.name = orxString_Store(model);
+  orxVector_Copy(&entry.position, &position);
+  Push(entry);
+}
+
+void game::SpawnQueue::Fire(orxU64 object, const orxSTRING event)
+{
+  const auto target = orxOBJECT(orxStructure_Get(object));
+  if (target == orxNULL)
+  {
+    return;
+  }
+
+  // Orders by the object's position at queuing time
+  Entry entry;
+  entry.name = orxString_Store(event);
+  entry.object = object;
+  orxObject_GetWorldPosition(target, &entry.position);
+  Push(entry);
+}
+
+void game::SpawnQueue::Push(Entry &entry)
+{
+  entry.wave = wave;
+  entry.sequence = sequence++;
+  entries.push(entry);
+}
+
+void game::SpawnQueue::Update()
+{
+  // Anything queued from now on belongs to the next wave
+  wave++;
+
+  if (entries.empty())
+  {
+    sequence = 0;
+    return;
+  }
+
+  orxConfig_PushSection("SpawnQueue");
+  const auto budget = orxConfig_GetFloat("Budget") / 1000.0;
+  orxConfig_PopSection();
+
+  const auto startTime = orxSystem_GetTime();
+  do
+  {
+    // Copies the entry out as processing it can queue new ones
+    const auto entry = entries.top();
+    entries.pop();
+    Process(entry);
+  } while (!entries.empty() && orxSystem_GetTime() - startTime < budget);
+}
+
+void game::SpawnQueue::Process(const Entry &entry) const
+{
+  if (entry.object == 0)
+  {
+    auto object = orxObject_CreateFromConfig(entry.name);
+    if (object != orxNULL)
+    {
+      orxObject_SetWorldPosition(object, &entry.position);
+    }
+  }
+  else
+  {
+    auto object = orxOBJECT(orxStructure_Get(entry.object));
+    if (object != orxNULL)
+    {
+      orxObject_FireTrigger(object, entry.name, orxNULL, 0);
+    }
+  }
+}
+
+void game::SpawnQueue::Clear()
+{
+  entries = {};
+  sequence = 0;
+}
+
+orxU32 game::SpawnQueue::GetCount() const
+{
+  return static_cast<orxU32>(entries.size());
+}
@@ -0,0 +1,116 @@
+/**
+ * @file TextCache.cpp
+ * @date 19-Oct-2026
+ */
+
+#include "TextCache.h"
+
+game::TextCache &game::TextCache::Get()
+{
+  static TextCache instance;
+  return instance;
+}
+
+void game::TextCache::Init()
+{
+  orxConfig_PushSection("TextCache");
+  capacity = orxConfig_GetU32("Capacity");
+  orxConfig_PopSection();
+}
+
+void game::TextCache::Exit()
+{
+#ifdef __orxPROFILER__
+  orxLOG("[TEXTCACHE] %u hits, %u misses.", hits, misses);
+#endif // __orxPROFILER__
+
+  for (const auto &entry : texts)
+  {
+    orxText_Delete(entry.second);
+  }
+  texts.clear();
+}
+
+orxTEXT *game::TextCache::GetText(const orxSTRING font, const orxSTRING string)
+{
+  const Key key{orxString_GetID(font), orxString_GetID(string)};
+  const auto found = texts.find(key);
+  if (found != texts.end())
+  {
+#ifdef __orxPROFILER__
+    hits++;
+#endif // __orxPROFILER__
+    return found->second;
+  }
+
+#ifdef __orxPROFILER__
+  misses++;
+#endif // __orxPROFILER__
+
+  if (texts.size() >= capacity)
+  {
+    Trim();
+  }
+
+  auto text = orxText_Create();
+  if (text == orxNULL)
+  {
+    return orxNULL;
+  }
+
+  // The text keeps its own reference to the font
+  auto fontObject = orxFont_CreateFromConfig(font);
+  orxText_SetFont(text, fontObject);
+  if (fontObject != orxNULL)
+  {
+    orxFont_Delete(fontObject);
+  }
+  orxText_SetString(text, string);
+
+  texts.emplace(key, text);
+  return text;
+}
+
+bool game::TextCache::SetText(orxOBJECT *object, const orxSTRING font, const orxSTRING string)
+{
+  auto graphic = orxOBJECT_GET_STRUCTURE(object, GRAPHIC);
+  auto text = (graphic != orxNULL) ? GetText(font, string) : orxNULL;
+  if (text == orxNULL)
+  {
+    return false;
+  }
+
+  // The graphic takes its own reference, the previous text is released
+  orxGraphic_SetData(graphic, orxSTRUCTURE(text));
+  return true;
+}
+
+void game::TextCache::Trim()
+{
+  for (auto it = texts.begin(); it != texts.end();)
+  {
+    if (orxStructure_GetRefCount(it->second) <= 1)
+    {
+      orxText_Delete(it->second);
+      it = texts.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+#ifdef __orxPROFILER__
+
+orxU32 game::TextCache::GetHitCount() const
+{
+  return hits;
+}
+
+orxU32 game::TextCache::GetMissCount() const
+{
+  return misses;
+}
+
+#endif // __orxPROFILER__
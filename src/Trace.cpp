@@ -0,0 +1,268 @@
+/**
+ * @file Trace.cpp
+ * @date 19-Oct-2026
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "Trace.h"
+
+game::Trace &game::Trace::Get()
+{
+  static Trace instance;
+  return instance;
+}
+
+#ifdef __orxPROFILER__
+
+namespace
+{
+  /// Events are written out once per frame, or sooner past this size
+  constexpr size_t flushSize = 1 << 20;
+}
+
+void game::Trace::Bootstrap()
+{
+  // Params can only be registered once they've been read from the command line
+  orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, &Trace::OnBootstrapEvent);
+  orxEvent_SetHandlerIDFlags(&Trace::OnBootstrapEvent, orxEVENT_TYPE_SYSTEM, orxNULL, orxEVENT_GET_FLAG(orxSYSTEM_EVENT_PARAM_READY), orxEVENT_KU32_MASK_ID_ALL);
+}
+
+void game::Trace::Init()
+{
+  orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, &Trace::OnBootstrapEvent);
+
+  if (path.empty())
+  {
+    return;
+  }
+
+  file = orxFile_Open(path.c_str(), orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+  if (file == orxNULL)
+  {
+    orxLOG("[TRACE] Can't open <%s> for writing.", path.c_str());
+    return;
+  }
+
+  origin = orxSystem_GetTime();
+  buffer = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+  orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, &Trace::OnEvent);
+  orxEvent_AddHandler(orxEVENT_TYPE_OBJECT, &Trace::OnEvent);
+  orxEvent_AddHandler(orxEVENT_TYPE_RENDER, &Trace::OnEvent);
+  orxEvent_SetHandlerIDFlags(&Trace::OnEvent, orxEVENT_TYPE_SYSTEM, orxNULL, orxEVENT_GET_FLAG(orxSYSTEM_EVENT_GAME_LOOP_START) | orxEVENT_GET_FLAG(orxSYSTEM_EVENT_GAME_LOOP_STOP), orxEVENT_KU32_MASK_ID_ALL);
+  orxEvent_SetHandlerIDFlags(&Trace::OnEvent, orxEVENT_TYPE_OBJECT, orxNULL, orxEVENT_GET_FLAG(orxOBJECT_EVENT_CREATE) | orxEVENT_GET_FLAG(orxOBJECT_EVENT_DELETE), orxEVENT_KU32_MASK_ID_ALL);
+  orxEvent_SetHandlerIDFlags(&Trace::OnEvent, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_GET_FLAG(orxRENDER_EVENT_START) | orxEVENT_GET_FLAG(orxRENDER_EVENT_STOP), orxEVENT_KU32_MASK_ID_ALL);
+
+  orxLOG("[TRACE] Recording to <%s>.", path.c_str());
+}
+
+void game::Trace::Exit()
+{
+  if (file == orxNULL)
+  {
+    return;
+  }
+
+  orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, &Trace::OnEvent);
+  orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, &Trace::OnEvent);
+  orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, &Trace::OnEvent);
+
+  buffer += "\n]}\n";
+  Flush();
+  orxFile_Close(file);
+  file = orxNULL;
+
+  orxLOG("[TRACE] Saved <%s>.", path.c_str());
+}
+
+bool game::Trace::IsRecording() const
+{
+  return file != orxNULL;
+}
+
+void game::Trace::Complete(const orxSTRING name, const orxSTRING category, orxDOUBLE start, orxDOUBLE end)
+{
+  orxCHAR event[256];
+  orxString_NPrint(event, sizeof(event), "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1}", name, category, ToMicroseconds(start), (end - start) * 1000000.0);
+  Append(event);
+}
+
+void game::Trace::Instant(const orxSTRING name, const orxSTRING category, const orxSTRING model)
+{
+  orxCHAR event[256];
+  orxString_NPrint(event, sizeof(event), "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":1,\"args\":{\"model\":\"%s\"}}", name, category, ToMicroseconds(orxSystem_GetTime()), model);
+  Append(event);
+}
+
+void game::Trace::Counter(const orxSTRING name, orxDOUBLE time, orxU32 count)
+{
+  orxCHAR event[256];
+  orxString_NPrint(event, sizeof(event), "{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{\"ms\":%.3f,\"calls\":%u}}", name, ToMicroseconds(frameStart), time * 1000.0, count);
+  Append(event);
+}
+
+orxSTATUS orxFASTCALL game::Trace::OnParam(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  if (_u32ParamCount < 2)
+  {
+    orxLOG("[TRACE] Missing output file, usage: -t <file>.");
+    return orxSTATUS_FAILURE;
+  }
+
+  Get().path = _azParams[1];
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL game::Trace::OnBootstrapEvent(const orxEVENT *_pstEvent)
+{
+  orxPARAM param = {orxPARAM_KU32_FLAG_STOP_ON_ERROR, "t", "trace", "Records a Chrome trace.", "Writes frame timelines to the given file as Chrome trace events (JSON), for chrome://tracing or Perfetto.", &Trace::OnParam};
+  orxParam_Register(&param);
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL game::Trace::OnEvent(const orxEVENT *_pstEvent)
+{
+  auto &trace = Get();
+
+  switch (_pstEvent->eType)
+  {
+  case orxEVENT_TYPE_SYSTEM:
+  {
+    const auto now = orxSystem_GetTime();
+    if (_pstEvent->eID == orxSYSTEM_EVENT_GAME_LOOP_START)
+    {
+      if (trace.frameStart >= 0.0)
+      {
+        trace.ReadProfilerFrame();
+      }
+      trace.frameStart = now;
+      trace.Flush();
+    }
+    else if (trace.frameStart >= 0.0)
+    {
+      trace.Complete("Frame", "frame", trace.frameStart, now);
+    }
+    break;
+  }
+
+  case orxEVENT_TYPE_OBJECT:
+  {
+    trace.Instant((_pstEvent->eID == orxOBJECT_EVENT_CREATE) ? "Create" : "Delete", "object", orxObject_GetName(orxOBJECT(_pstEvent->hSender)));
+    break;
+  }
+
+  case orxEVENT_TYPE_RENDER:
+  {
+    if (_pstEvent->eID == orxRENDER_EVENT_START)
+    {
+      trace.renderStart = orxSystem_GetTime();
+    }
+    else
+    {
+      trace.Complete("Render", "render", trace.renderStart, orxSystem_GetTime());
+    }
+    break;
+  }
+
+  default:
+    break;
+  }
+
+  return orxSTATUS_SUCCESS;
+}
+
+void game::Trace::ReadProfilerFrame()
+{
+  if (orxProfiler_SelectQueryFrame(0, orxTHREAD_KU32_MAIN_THREAD_ID) == orxSTATUS_FAILURE)
+  {
+    return;
+  }
+
+  struct Marker
+  {
+    const orxSTRING name;
+    orxDOUBLE start;
+    orxDOUBLE time;
+  };
+  std::vector<Marker> markers;
+
+  for (auto id = orxProfiler_GetNextMarkerID(orxPROFILER_KS32_MARKER_ID_NONE); id != orxPROFILER_KS32_MARKER_ID_NONE; id = orxProfiler_GetNextMarkerID(id))
+  {
+    const orxU32 count = orxProfiler_GetMarkerPushCount(id);
+    if (count == 0)
+    {
+      continue;
+    }
+
+    const orxDOUBLE time = orxProfiler_GetMarkerTime(id);
+    if (orxProfiler_IsUniqueMarker(id))
+    {
+      markers.push_back({orxProfiler_GetMarkerName(id), orxProfiler_GetUniqueMarkerStartTime(id), time});
+    }
+    else
+    {
+      // Pushed several times: only totals are known
+      Counter(orxProfiler_GetMarkerName(id), time, count);
+    }
+  }
+
+  // Marker start times are relative to the profiler's own frame, aligns its start with ours
+  if (!markers.empty())
+  {
+    const auto base = std::min_element(markers.begin(), markers.end(), [](const auto &a, const auto &b)
+                                       { return a.start < b.start; })
+                          ->start;
+    for (const auto &marker : markers)
+    {
+      const auto start = frameStart + (marker.start - base);
+      Complete(marker.name, "orx", start, start + marker.time);
+    }
+  }
+}
+
+void game::Trace::Append(const orxCHAR *event)
+{
+  if (!first)
+  {
+    buffer += ",\n";
+  }
+  first = false;
+  buffer += event;
+
+  if (buffer.size() >= flushSize)
+  {
+    Flush();
+  }
+}
+
+void game::Trace::Flush()
+{
+  if (!buffer.empty())
+  {
+    orxFile_Write(buffer.data(), 1, buffer.size(), file);
+    buffer.clear();
+  }
+}
+
+orxDOUBLE game::Trace::ToMicroseconds(orxDOUBLE time) const
+{
+  return (time - origin) * 1000000.0;
+}
+
+#else // __orxPROFILER__
+
+void game::Trace::Bootstrap()
+{
+}
+
+void game::Trace::Init()
+{
+}
+
+void game::Trace::Exit()
+{
+}
+
+#endif // __orxPROFILER__
@@ -0,0 +1,184 @@
+/**
+ * @file Voices.cpp
+ * @date 19-Oct-2026
+ */
+
+#include <utility>
+
+#include "Voices.h"
+
+namespace
+{
+  bool IsPlaying(orxSOUND *sound)
+  {
+    return orxSound_GetStatus(sound) == orxSOUND_STATUS_PLAY;
+  }
+
+  /// Voices.Play Sound
+  void orxFASTCALL CommandPlay(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+  {
+    _pstResult->bValue = game::Voices::Get().Play(_astArgList[0].zValue) ? orxTRUE : orxFALSE;
+  }
+}
+
+game::Voices &game::Voices::Get()
+{
+  static Voices instance;
+  return instance;
+}
+
+void game::Voices::Init()
+{
+  static const orxCOMMAND_VAR_DEF result = {"Success", orxCOMMAND_VAR_TYPE_BOOL};
+  static const orxCOMMAND_VAR_DEF params[] = {{"Sound", orxCOMMAND_VAR_TYPE_STRING}};
+
+  orxCommand_Register("Voices.Play", &CommandPlay, 1, 0, params, &result);
+
+  orxConfig_PushSection("Voices");
+  maxVoices = orxConfig_GetU32("MaxVoices");
+
+  // Decodes short effects now rather than on their first play
+  for (orxS32 i = 0, count = orxConfig_GetListCount("PreloadList"); i < count; i++)
+  {
+    const auto sound = orxConfig_GetListString("PreloadList", i);
+    auto &pool = GetPool(sound);
+    if (pool.voices.empty() && AddVoice(pool, sound) == orxNULL)
+    {
+      orxLOG("[VOICES] Can't preload <%s>.", sound);
+    }
+  }
+  orxConfig_PopSection();
+}
+
+void game::Voices::Exit()
+{
+  Clear();
+
+  orxCommand_Unregister("Voices.Play");
+}
+
+void game::Voices::Clear()
+{
+  for (auto &entry : pools)
+  {
+    for (auto &voice : entry.second.voices)
+    {
+      orxSound_Delete(voice.sound);
+    }
+  }
+  pools.clear();
+}
+
+game::Voices::Pool &game::Voices::GetPool(const orxSTRING sound)
+{
+  const auto id = orxString_GetID(sound);
+  const auto found = pools.find(id);
+  if (found != pools.end())
+  {
+    return found->second;
+  }
+
+  Pool pool;
+  orxConfig_PushSection(sound);
+  if (orxConfig_HasValue("MaxVoices"))
+  {
+    pool.maxVoices = orxMAX(orxConfig_GetU32("MaxVoices"), 1u);
+  }
+  pool.priority = orxConfig_GetS32("Priority");
+  orxConfig_PopSection();
+  pool.voices.reserve(pool.maxVoices);
+
+  return pools.emplace(id, std::move(pool)).first->second;
+}
+
+game::Voices::Voice *game::Voices::FindVictim(orxS32 priority, orxU32 &playing)
+{
+  Voice *victim = orxNULL;
+  orxS32 victimPriority = priority;
+  playing = 0;
+  for (auto &entry : pools)
+  {
+    for (auto &voice : entry.second.voices)
+    {
+      if (IsPlaying(voice.sound))
+      {
+        playing++;
+        if (entry.second.priority < victimPriority || (entry.second.priority == victimPriority && (victim == orxNULL || voice.startTime < victim->startTime)))
+        {
+          victim = &voice;
+          victimPriority = entry.second.priority;
+        }
+      }
+    }
+  }
+  return victim;
+}
+
+game::Voices::Voice *game::Voices::AddVoice(Pool &pool, const orxSTRING sound)
+{
+  auto created = orxSound_CreateFromConfig(sound);
+  if (created == orxNULL)
+  {
+    return orxNULL;
+  }
+  pool.voices.push_back({created, 0.0});
+  return &pool.voices.back();
+}
+
+void game::Voices::Start(Voice &voice)
+{
+  // Stopping rewinds, so a stolen voice starts over
+  orxSound_Stop(voice.sound);
+  orxSound_Play(voice.sound);
+  voice.startTime = orxSystem_GetTime();
+}
+
+bool game::Voices::Play(const orxSTRING sound)
+{
+  auto &pool = GetPool(sound);
+
+  // Reuses a finished voice, or the sound's oldest one once at its cap
+  Voice *voice = orxNULL;
+  for (auto &candidate : pool.voices)
+  {
+    if (!IsPlaying(candidate.sound))
+    {
+      voice = &candidate;
+      break;
+    }
+  }
+  if (voice == orxNULL && pool.voices.size() >= pool.maxVoices)
+  {
+    voice = &pool.voices.front();
+    for (auto &candidate : pool.voices)
+    {
+      if (candidate.startTime < voice->startTime)
+      {
+        voice = &candidate;
+      }
+    }
+  }
+
+  // Keeps the overall voice count in check, unless this one replaces a playing voice
+  if (maxVoices != 0 && (voice == orxNULL || !IsPlaying(voice->sound)))
+  {
+    orxU32 playing = 0;
+    const auto victim = FindVictim(pool.priority, playing);
+    if (playing >= maxVoices)
+    {
+      if (victim == orxNULL)
+      {
+        return false;
+      }
+      orxSound_Stop(victim->sound);
+    }
+  }
+
+  if (voice == orxNULL && (voice = AddVoice(pool, sound)) == orxNULL)
+  {
+    return false;
+  }
+
+  Start(*voice);
+  return true;
+}
@@ -0,0 +1,8 @@
+/**
+ * @file orxExtensions.cpp
+ * @date 19-Oct-2026
+ */
+
+// Extensions, including orxBundle and its embedded data (orxBundleData.inc),
+// are compiled here only: regenerating the bundle rebuilds this unit alone
+#include "orxExtensions.h"
@@ -3,12 +3,24 @@
  * @date 19-Mar-2024
  */
 
-#define __SCROLL_IMPL__
 #include "planet.h"
-#undef __SCROLL_IMPL__
 
+#include "Atlas.h"
+#include "ConfigCache.h"
+#include "Extensions.h"
+#include "Memory.h"
+#include "Metrics.h"
 #include "Object.h"
-#include "orxExtensions.h"
+#include "Particles.h"
+#include "Profiler.h"
+#include "Random.h"
+#include "Replay.h"
+#include "SdfFont.h"
+#include "Snapshot.h"
+#include "SpawnQueue.h"
+#include "TextCache.h"
+#include "Trace.h"
+#include "Voices.h"
 
 #ifdef __orxMSVC__
 
@@ -28,6 +40,33 @@ void planet::Update(const orxCLOCK_INFO &_rstInfo)
     // Send close event
     orxEvent_SendShort(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_CLOSE);
   }
+
+  // Checkpoint shortcuts
+  if (orxInput_HasBeenActivated("SaveSnapshot"))
+  {
+    game::Snapshot::Get().Save();
+  }
+  else if (orxInput_HasBeenActivated("LoadSnapshot"))
+  {
+    game::Snapshot::Get().Load();
+  }
+
+  // Deferred spawns, within this frame's budget
+  game::SpawnQueue::Get().Update();
+
+  // Metrics overlay
+  if (orxInput_HasBeenActivated("ToggleMetrics"))
+  {
+    game::Metrics::Get().Show(!game::Metrics::Get().IsShown());
+  }
+
+#ifdef __orxPROFILER__
+  // Per-model update & collision times
+  if (orxInput_HasBeenActivated("ShowModelProfile"))
+  {
+    game::Profiler::Get().Show();
+  }
+#endif // __orxPROFILER__
 }
 
 /** Init function, it is called when all orx's modules have been initialized
@@ -37,8 +76,57 @@ orxSTATUS planet::Init()
   // Init extensions
   InitExtensions();
 
-  // Create the scene
-  CreateObject("Startup");
+  // Release bundled resources as soon as they've been read
+  orxConfig_PushSection("Bundle");
+  orxBundle_SetReadOnce(orxConfig_GetBool("ReadOnce"));
+  orxConfig_PopSection();
+
+  // Pack the texture atlas & generate the distance field font when bundling, then switch over to them
+  const auto bundling = orxBundle_IsProcessing() != orxFALSE;
+  game::Atlas::Get().Init(bundling);
+  game::SdfFont::Get().Init(bundling);
+
+  // Register profiling commands, start recording a trace if requested
+  game::Profiler::Get().Init();
+  game::Trace::Get().Init();
+
+  // Count objects, merges & bundle reads
+  game::Metrics::Get().Init();
+
+  // Track memory per subsystem against its budget
+  game::Memory::Get().Init();
+
+  // Seed game randomness
+  game::Random::Get().Init();
+
+  // Register snapshot commands
+  game::Snapshot::Get().Init();
+
+  // Set up batched particles
+  game::Particles::Get().Init();
+
+  // Register deferred spawn commands
+  game::SpawnQueue::Get().Init();
+
+  // Share laid out texts
+  game::TextCache::Get().Init();
+
+  // Reuse sound effect voices
+  game::Voices::Get().Init();
+
+  // Play back a recorded game session, start from a snapshot, or start normally
+  if (game::Replay::Get().Init())
+  {
+    CreateObject("GameScene");
+  }
+  else
+  {
+    orxConfig_PushSection("Snapshot");
+    const auto fromSnapshot = orxConfig_HasValue("Load");
+    orxConfig_PopSection();
+
+    CreateObject(fromSnapshot ? "SnapshotStartup" : "Startup");
+  }
 
   // Done!
   return orxSTATUS_SUCCESS;
@@ -56,6 +144,19 @@ orxSTATUS planet::Run()
  */
 void planet::Exit()
 {
+  // Flush any game session being recorded
+  game::Replay::Get().Exit();
+  game::SpawnQueue::Get().Exit();
+  game::TextCache::Get().Exit();
+  game::Voices::Get().Exit();
+  game::Particles::Get().Exit();
+  game::Snapshot::Get().Exit();
+  game::Random::Get().Exit();
+  game::Memory::Get().Exit();
+  game::Metrics::Get().Exit();
+  game::Trace::Get().Exit();
+  game::Profiler::Get().Exit();
+
   // Exit from extensions
   ExitExtensions();
 
@@ -67,9 +168,27 @@ void planet::Exit()
 void planet::BindObjects()
 {
   // Bind Scroll classes to matching config sections
+  ScrollBindObject<game::Background>("Background");
   ScrollBindObject<game::Dropper>("Dropper");
+  ScrollBindObject<game::GameScene>("GameScene");
   ScrollBindObject<Object>("Object");
+  ScrollBindObject<game::ParticleField>("ParticleField");
   ScrollBindObject<game::Planet>("Planet");
+  ScrollBindObject<game::Score>("Score");
+}
+
+/** Object callbacks, called for all objects created or deleted at runtime
+ */
+void planet::OnObjectCreate(ScrollObject *_poObject)
+{
+  static const auto created = game::Metrics::Get().AddCounter("ObjectsCreated");
+  game::Metrics::Get().Increment(created);
+}
+
+void planet::OnObjectDelete(ScrollObject *_poObject)
+{
+  static const auto deleted = game::Metrics::Get().AddCounter("ObjectsDeleted");
+  game::Metrics::Get().Increment(deleted);
 }
 
 /** Bootstrap function, it is called before config is initialized, allowing for early resource storage definitions
@@ -79,14 +198,23 @@ orxSTATUS planet::Bootstrap() const
   // Bootstrap extensions
   BootstrapExtensions();
 
+  // Trace command line parameter
+  game::Trace::Get().Bootstrap();
+
+  // Load the precompiled config from the bundle, or build it when bundling
+  const auto cached = game::ConfigCache::Get().Bootstrap();
+
   // Return orxSTATUS_FAILURE to prevent orx from loading the default config file
-  return orxSTATUS_SUCCESS;
+  return cached ? orxSTATUS_FAILURE : orxSTATUS_SUCCESS;
 }
 
 /** Main function
  */
 int main(int argc, char **argv)
 {
+  // The config cache is rebuilt rather than used when bundling
+  game::ConfigCache::Get().SetArgs(argc, argv);
+
   // Execute our game
   planet::GetInstance().Execute(argc, argv);
 